@@ -0,0 +1,293 @@
+#include "stevensFileLib.hpp"
+#include "benchmark_support.hpp"
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// ============================================================================
+// Allocation counting
+//
+// This translation unit replaces the global operator new and delete, so it is
+// built as its own executable (stevensFileLib_allocation_benchmarks) and the
+// timing numbers of the main suite are unaffected. Each benchmark reports:
+//
+//   allocs_per_iter / bytes_per_iter   operator new calls and bytes requested per call
+//   allocs_per_line / bytes_per_line   the same divided by lines (or tokens) processed
+//
+// Over-aligned operator new is not replaced; the library allocates no over-aligned types.
+// ============================================================================
+
+namespace
+{
+    std::atomic<uint64_t> allocationCount{0};
+    std::atomic<uint64_t> allocatedBytes{0};
+
+    void* countedAllocate(std::size_t size)
+    {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+        allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+        if (size == 0)
+            size = 1;
+        for (;;)
+        {
+            if (void* memory = std::malloc(size))
+                return memory;
+            std::new_handler handler = std::get_new_handler();
+            if (handler == nullptr)
+                throw std::bad_alloc();
+            handler();
+        }
+    }
+}
+
+void* operator new(std::size_t size) { return countedAllocate(size); }
+void* operator new[](std::size_t size) { return countedAllocate(size); }
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return countedAllocate(size);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept { return operator new(size, tag); }
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete[](void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { std::free(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { std::free(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { std::free(memory); }
+
+namespace
+{
+    using namespace benchmarkSupport;
+
+    /**
+     * @brief Captures the allocation counters when a benchmark's timed loop starts
+     *
+     * Call report() after the loop; setup before the loop is not counted. The counters
+     * are process-wide, so these benchmarks run single-threaded.
+     */
+    class AllocationScope
+    {
+    public:
+        AllocationScope()
+            : startCount_(allocationCount.load(std::memory_order_relaxed)),
+              startBytes_(allocatedBytes.load(std::memory_order_relaxed))
+        {
+        }
+
+        /**
+         * @param state Benchmark state whose loop has finished
+         * @param linesPerIteration Lines or tokens one iteration handles; 0 skips the per-line counters
+         */
+        void report(benchmark::State& state, int64_t linesPerIteration) const
+        {
+            const auto count = static_cast<double>(allocationCount.load(std::memory_order_relaxed) - startCount_);
+            const auto bytes = static_cast<double>(allocatedBytes.load(std::memory_order_relaxed) - startBytes_);
+            state.counters["allocs_per_iter"] = benchmark::Counter(count, benchmark::Counter::kAvgIterations);
+            state.counters["bytes_per_iter"] = benchmark::Counter(bytes, benchmark::Counter::kAvgIterations);
+
+            if (linesPerIteration <= 0 || state.iterations() == 0)
+                return;
+            const double lines = static_cast<double>(state.iterations()) * static_cast<double>(linesPerIteration);
+            state.counters["allocs_per_line"] = count / lines;
+            state.counters["bytes_per_line"] = bytes / lines;
+        }
+
+    private:
+        uint64_t startCount_;
+        uint64_t startBytes_;
+    };
+
+    const LineFile& lineFile(int64_t lineLength)
+    {
+        return GeneratedFiles::get({lineLength, 4 * MiB, '\n'});
+    }
+
+    /**
+     * @brief A comma-separated text of tokenCount short tokens
+     */
+    std::string makeDelimitedText(int64_t tokenCount)
+    {
+        std::string text;
+        for (int64_t i = 0; i < tokenCount; ++i)
+        {
+            if (i > 0)
+                text += ',';
+            text += "token" + std::to_string(i);
+        }
+        return text;
+    }
+}
+
+// ============================================================================
+// Loading
+// ============================================================================
+
+static void Allocations_LoadFileIntoVector(benchmark::State& state)
+{
+    const LineFile& file = lineFile(state.range(0));
+
+    AllocationScope allocations;
+    for (auto _ : state)
+    {
+        auto lines = stevensFileLib::loadFileIntoVector(file.path);
+        benchmark::DoNotOptimize(lines);
+    }
+    allocations.report(state, file.lines);
+}
+BENCHMARK(Allocations_LoadFileIntoVector)->ArgName("line_length")->Arg(8)->Arg(64)->Arg(512)->Unit(benchmark::kMillisecond);
+
+static void Allocations_LoadFileIntoVector_Filtered(benchmark::State& state)
+{
+    const LineFile& file = lineFile(64);
+    std::unordered_map<std::string, std::vector<std::string>> settings;
+    settings["skip if starts with"] = {"#"};
+    settings["skip if contains"] = {"SKIP"};
+
+    AllocationScope allocations;
+    for (auto _ : state)
+    {
+        auto lines = stevensFileLib::loadFileIntoVector(file.path, settings);
+        benchmark::DoNotOptimize(lines);
+    }
+    allocations.report(state, file.lines);
+}
+BENCHMARK(Allocations_LoadFileIntoVector_Filtered)->Unit(benchmark::kMillisecond);
+
+static void Allocations_LoadFileIntoHashSet(benchmark::State& state)
+{
+    const LineFile& file = lineFile(64);
+
+    AllocationScope allocations;
+    for (auto _ : state)
+    {
+        auto lines = stevensFileLib::loadFileIntoHashSet(file.path);
+        benchmark::DoNotOptimize(lines);
+    }
+    allocations.report(state, file.lines);
+}
+BENCHMARK(Allocations_LoadFileIntoHashSet)->Unit(benchmark::kMillisecond);
+
+static void Allocations_LoadDelimitedFile(benchmark::State& state)
+{
+    const LineFile& file = lineFile(64);
+
+    AllocationScope allocations;
+    for (auto _ : state)
+    {
+        auto table = stevensFileLib::loadDelimitedFile(file.path);
+        benchmark::DoNotOptimize(table);
+    }
+    allocations.report(state, file.lines);
+}
+BENCHMARK(Allocations_LoadDelimitedFile)->Unit(benchmark::kMillisecond);
+
+static void Allocations_LineReader(benchmark::State& state)
+{
+    const LineFile& file = lineFile(64);
+
+    AllocationScope allocations;
+    for (auto _ : state)
+    {
+        stevensFileLib::LineReader reader(file.path);
+        std::string_view line;
+        size_t bytes = 0;
+        while (reader.next(line))
+            bytes += line.size();
+        benchmark::DoNotOptimize(bytes);
+    }
+    allocations.report(state, file.lines);
+}
+BENCHMARK(Allocations_LineReader)->Unit(benchmark::kMillisecond);
+
+static void Allocations_GetRandomFileLine(benchmark::State& state)
+{
+    const LineFile& file = lineFile(64);
+
+    AllocationScope allocations;
+    for (auto _ : state)
+    {
+        auto line = stevensFileLib::getRandomFileLine(file.path);
+        benchmark::DoNotOptimize(line);
+    }
+    allocations.report(state, 0);
+}
+BENCHMARK(Allocations_GetRandomFileLine);
+
+// ============================================================================
+// Splitting
+// ============================================================================
+
+static void Allocations_SplitString(benchmark::State& state)
+{
+    const std::string text = makeDelimitedText(state.range(0));
+
+    AllocationScope allocations;
+    for (auto _ : state)
+    {
+        auto tokens = stevensFileLib::internal::splitString(text, ",");
+        benchmark::DoNotOptimize(tokens);
+    }
+    allocations.report(state, state.range(0));
+}
+BENCHMARK(Allocations_SplitString)->ArgName("tokens")->Arg(8)->Arg(64)->Arg(1024);
+
+static void Allocations_SplitViewInto(benchmark::State& state)
+{
+    const std::string text = makeDelimitedText(state.range(0));
+    std::vector<std::string_view> tokens;
+
+    AllocationScope allocations;
+    for (auto _ : state)
+    {
+        stevensFileLib::splitViewInto(text, ",", tokens);
+        benchmark::DoNotOptimize(tokens);
+    }
+    allocations.report(state, state.range(0));
+}
+BENCHMARK(Allocations_SplitViewInto)->ArgName("tokens")->Arg(8)->Arg(64)->Arg(1024);
+
+// ============================================================================
+// Writing
+// ============================================================================
+
+static void Allocations_WriteLinesToFile(benchmark::State& state)
+{
+    const LineFile& file = lineFile(64);
+    const auto lines = stevensFileLib::loadFileIntoVector(file.path);
+    const std::string target = "benchmark_data/generated/allocation_write_target.txt";
+
+    AllocationScope allocations;
+    for (auto _ : state)
+        stevensFileLib::writeLinesToFile(target, lines);
+    allocations.report(state, file.lines);
+}
+BENCHMARK(Allocations_WriteLinesToFile)->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv)
+{
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    if (fs::exists("benchmark_data"))
+        fs::remove_all("benchmark_data");
+
+    return 0;
+}
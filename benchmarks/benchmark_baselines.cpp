@@ -0,0 +1,243 @@
+#include "stevensFileLib.hpp"
+#include "benchmark_support.hpp"
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <dirent.h>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+
+// ============================================================================
+// Raw POSIX baselines
+//
+// Hand-written equivalents of the library calls with no filtering, no error
+// reporting and no allocations beyond what the result requires. They mark the
+// practical floor for each operation; the ratio table printed at the end of a
+// console run divides each library benchmark's time by its baseline.
+// ============================================================================
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    const std::string largeFile = "benchmark_data/large.txt";
+
+    /**
+     * @brief Counts separator-terminated records with read() into a reused buffer and memchr()
+     */
+    size_t countLinesWithRead(const std::string& path)
+    {
+        int descriptor = ::open(path.c_str(), O_RDONLY);
+        if (descriptor < 0)
+            return 0;
+
+        std::vector<char> buffer(1 << 20);
+        size_t lines = 0;
+        ssize_t bytesRead;
+        while ((bytesRead = ::read(descriptor, buffer.data(), buffer.size())) > 0)
+        {
+            const char* cursor = buffer.data();
+            const char* end = cursor + bytesRead;
+            while ((cursor = static_cast<const char*>(std::memchr(cursor, '\n', static_cast<size_t>(end - cursor)))))
+            {
+                ++lines;
+                ++cursor;
+            }
+        }
+        ::close(descriptor);
+        return lines;
+    }
+
+    /**
+     * @brief Splits a file into strings with read() and memchr(); the floor for loadFileIntoVector
+     */
+    std::vector<std::string> loadLinesWithRead(const std::string& path)
+    {
+        std::vector<std::string> lines;
+        int descriptor = ::open(path.c_str(), O_RDONLY);
+        if (descriptor < 0)
+            return lines;
+
+        std::vector<char> buffer(1 << 20);
+        std::string partial;
+        ssize_t bytesRead;
+        while ((bytesRead = ::read(descriptor, buffer.data(), buffer.size())) > 0)
+        {
+            const char* cursor = buffer.data();
+            const char* end = cursor + bytesRead;
+            const char* newline;
+            while ((newline = static_cast<const char*>(std::memchr(cursor, '\n', static_cast<size_t>(end - cursor)))))
+            {
+                partial.append(cursor, newline);
+                lines.push_back(std::move(partial));
+                partial.clear();
+                cursor = newline + 1;
+            }
+            partial.append(cursor, end);
+        }
+        if (!partial.empty())
+            lines.push_back(std::move(partial));
+        ::close(descriptor);
+        return lines;
+    }
+
+    /**
+     * @brief Counts lines of a memory-mapped file
+     */
+    size_t countLinesWithMmap(const std::string& path)
+    {
+        int descriptor = ::open(path.c_str(), O_RDONLY);
+        if (descriptor < 0)
+            return 0;
+
+        struct stat info;
+        ::fstat(descriptor, &info);
+        size_t size = static_cast<size_t>(info.st_size);
+        void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        ::close(descriptor);
+        if (mapping == MAP_FAILED)
+            return 0;
+
+        const char* cursor = static_cast<const char*>(mapping);
+        const char* end = cursor + size;
+        size_t lines = 0;
+        while ((cursor = static_cast<const char*>(std::memchr(cursor, '\n', static_cast<size_t>(end - cursor)))))
+        {
+            ++lines;
+            ++cursor;
+        }
+        ::munmap(mapping, size);
+        return lines;
+    }
+}
+
+// ============================================================================
+// Reading
+// ============================================================================
+
+static void Baseline_ReadMemchr_LargeFile(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(countLinesWithRead(largeFile));
+
+    benchmarkSupport::setThroughput(state, static_cast<int64_t>(fs::file_size(largeFile)), 1000000);
+}
+BENCHMARK(Baseline_ReadMemchr_LargeFile);
+
+static void Baseline_ReadMemchrStrings_LargeFile(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto lines = loadLinesWithRead(largeFile);
+        benchmark::DoNotOptimize(lines);
+    }
+
+    benchmarkSupport::setThroughput(state, static_cast<int64_t>(fs::file_size(largeFile)), 1000000);
+}
+BENCHMARK(Baseline_ReadMemchrStrings_LargeFile);
+
+static void Baseline_MmapScan_LargeFile(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(countLinesWithMmap(largeFile));
+
+    benchmarkSupport::setThroughput(state, static_cast<int64_t>(fs::file_size(largeFile)), 1000000);
+}
+BENCHMARK(Baseline_MmapScan_LargeFile);
+
+// ============================================================================
+// Directory listing
+// ============================================================================
+
+static void Baseline_Readdir(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::vector<std::string> names;
+        DIR* directory = ::opendir("benchmark_data");
+        if (directory == nullptr)
+        {
+            state.SkipWithError("opendir failed");
+            break;
+        }
+        while (dirent* entry = ::readdir(directory))
+        {
+            if (entry->d_type == DT_REG)
+                names.emplace_back(entry->d_name);
+        }
+        ::closedir(directory);
+        benchmark::DoNotOptimize(names);
+    }
+}
+BENCHMARK(Baseline_Readdir);
+
+// ============================================================================
+// Writing
+// ============================================================================
+
+static void Baseline_WriteLoop_LargeFile(benchmark::State& state)
+{
+    const std::string testFile = "benchmark_data/baseline_write_test.txt";
+    auto lines = loadLinesWithRead(largeFile);
+    std::string buffer;
+
+    for (auto _ : state)
+    {
+        int descriptor = ::open(testFile.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        buffer.clear();
+        for (const auto& line : lines)
+        {
+            buffer.append(line);
+            buffer.push_back('\n');
+            if (buffer.size() < (1 << 20))
+                continue;
+            benchmark::DoNotOptimize(::write(descriptor, buffer.data(), buffer.size()));
+            buffer.clear();
+        }
+        benchmark::DoNotOptimize(::write(descriptor, buffer.data(), buffer.size()));
+        ::close(descriptor);
+    }
+
+    benchmarkSupport::setThroughput(state, static_cast<int64_t>(fs::file_size(testFile)), 1000000);
+    fs::remove(testFile);
+}
+BENCHMARK(Baseline_WriteLoop_LargeFile);
+
+static void Baseline_AppendWrite(benchmark::State& state)
+{
+    const std::string testFile = "benchmark_data/baseline_append_test.txt";
+    const std::string content = "test line\n";
+
+    for (auto _ : state)
+    {
+        int descriptor = ::open(testFile.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+        benchmark::DoNotOptimize(::write(descriptor, content.data(), content.size()));
+        ::close(descriptor);
+    }
+
+    fs::remove(testFile);
+}
+BENCHMARK(Baseline_AppendWrite);
+
+// ============================================================================
+// Pairs for the ratio table
+// ============================================================================
+
+namespace
+{
+    [[maybe_unused]] const bool baselinesRegistered =
+        benchmarkSupport::registerBaselinePair("LoadFileIntoVector_LargeFile", "Baseline_ReadMemchrStrings_LargeFile") &&
+        benchmarkSupport::registerBaselinePair("LoadFileIntoVector_LargeFile", "Baseline_ReadMemchr_LargeFile") &&
+        benchmarkSupport::registerBaselinePair("LoadFileIntoVector_LargeFile", "Baseline_MmapScan_LargeFile") &&
+        benchmarkSupport::registerBaselinePair("ListFiles_NoFilter", "Baseline_Readdir") &&
+        benchmarkSupport::registerBaselinePair("WriteLinesToFile_LargeFile", "Baseline_WriteLoop_LargeFile") &&
+        benchmarkSupport::registerBaselinePair("AppendToFile", "Baseline_AppendWrite");
+}
+
+#endif
@@ -0,0 +1,523 @@
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// stevensFileLib_benchmark_compare
+//
+//   stevensFileLib_benchmark_compare <baseline.json> <current.json> [--threshold=PERCENT]
+//                                    [--allow-missing]
+//
+// Compares two Google Benchmark JSON files and prints one row per benchmark. Every
+// benchmark is compared by throughput (bytes/s, else items/s, else runs/s from
+// real time), using the median aggregate when the run used repetitions. Exits
+// with 1 when any benchmark's throughput fell by more than the threshold
+// (default 10%), when a benchmark reported an error in the current run, or when a
+// baseline benchmark is absent from the current run (unless --allow-missing), or
+// when the two files come from different build types; 2 on bad input; and 0
+// otherwise.
+// ============================================================================
+
+namespace
+{
+    // ========================================================================
+    // Minimal JSON reader, enough for Google Benchmark output
+    // ========================================================================
+
+    struct JsonValue
+    {
+        enum class Type
+        {
+            Null,
+            Boolean,
+            Number,
+            String,
+            Array,
+            Object
+        };
+
+        Type type = Type::Null;
+        bool boolean = false;
+        double number = 0;
+        std::string string;
+        std::vector<JsonValue> items;               ///< Array elements, or object values
+        std::vector<std::string> keys;              ///< Object keys, parallel to items
+
+        const JsonValue* find(const std::string& key) const
+        {
+            for (size_t i = 0; i < keys.size(); ++i)
+            {
+                if (keys[i] == key)
+                    return &items[i];
+            }
+            return nullptr;
+        }
+
+        std::string stringOr(const std::string& key, const std::string& fallback) const
+        {
+            const JsonValue* value = find(key);
+            return value != nullptr && value->type == Type::String ? value->string : fallback;
+        }
+
+        double numberOr(const std::string& key, double fallback) const
+        {
+            const JsonValue* value = find(key);
+            return value != nullptr && value->type == Type::Number ? value->number : fallback;
+        }
+    };
+
+    class JsonParser
+    {
+    public:
+        explicit JsonParser(const std::string& text) : text_(text) {}
+
+        JsonValue parseDocument()
+        {
+            JsonValue value = parseValue();
+            skipWhitespace();
+            if (position_ != text_.size())
+                fail("trailing characters");
+            return value;
+        }
+
+    private:
+        JsonValue parseValue()
+        {
+            skipWhitespace();
+            if (position_ >= text_.size())
+                fail("unexpected end of input");
+
+            JsonValue value;
+            char c = text_[position_];
+            if (c == '{')
+                return parseObject();
+            if (c == '[')
+                return parseArray();
+            if (c == '"')
+            {
+                value.type = JsonValue::Type::String;
+                value.string = parseString();
+                return value;
+            }
+            if (consumeWord("true") || consumeWord("false"))
+            {
+                value.type = JsonValue::Type::Boolean;
+                value.boolean = c == 't';
+                return value;
+            }
+            if (consumeWord("null"))
+                return value;
+            return parseNumber();
+        }
+
+        JsonValue parseObject()
+        {
+            JsonValue value;
+            value.type = JsonValue::Type::Object;
+            expect('{');
+            if (consume('}'))
+                return value;
+            do
+            {
+                skipWhitespace();
+                value.keys.push_back(parseString());
+                expect(':');
+                value.items.push_back(parseValue());
+            } while (consume(','));
+            expect('}');
+            return value;
+        }
+
+        JsonValue parseArray()
+        {
+            JsonValue value;
+            value.type = JsonValue::Type::Array;
+            expect('[');
+            if (consume(']'))
+                return value;
+            do
+            {
+                value.items.push_back(parseValue());
+            } while (consume(','));
+            expect(']');
+            return value;
+        }
+
+        std::string parseString()
+        {
+            expect('"');
+            std::string result;
+            while (position_ < text_.size() && text_[position_] != '"')
+            {
+                char c = text_[position_++];
+                if (c != '\\')
+                {
+                    result += c;
+                    continue;
+                }
+                if (position_ >= text_.size())
+                    fail("unterminated escape");
+                appendEscape(result, text_[position_++]);
+            }
+            expect('"');
+            return result;
+        }
+
+        void appendEscape(std::string& result, char escape)
+        {
+            switch (escape)
+            {
+            case 'b': result += '\b'; return;
+            case 'f': result += '\f'; return;
+            case 'n': result += '\n'; return;
+            case 'r': result += '\r'; return;
+            case 't': result += '\t'; return;
+            case 'u': break;
+            default: result += escape; return;
+            }
+
+            if (position_ + 4 > text_.size())
+                fail("truncated \\u escape");
+            unsigned long code = std::strtoul(text_.substr(position_, 4).c_str(), nullptr, 16);
+            position_ += 4;
+            if (code < 0x80)
+            {
+                result += static_cast<char>(code);
+            }
+            else if (code < 0x800)
+            {
+                result += static_cast<char>(0xC0 | (code >> 6));
+                result += static_cast<char>(0x80 | (code & 0x3F));
+            }
+            else
+            {
+                result += static_cast<char>(0xE0 | (code >> 12));
+                result += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                result += static_cast<char>(0x80 | (code & 0x3F));
+            }
+        }
+
+        JsonValue parseNumber()
+        {
+            const char* start = text_.c_str() + position_;
+            char* end = nullptr;
+            JsonValue value;
+            value.type = JsonValue::Type::Number;
+            value.number = std::strtod(start, &end);
+            if (end == start)
+                fail("unexpected character");
+            position_ += static_cast<size_t>(end - start);
+            return value;
+        }
+
+        void skipWhitespace()
+        {
+            while (position_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[position_])))
+                ++position_;
+        }
+
+        bool consume(char c)
+        {
+            skipWhitespace();
+            if (position_ >= text_.size() || text_[position_] != c)
+                return false;
+            ++position_;
+            return true;
+        }
+
+        bool consumeWord(const char* word)
+        {
+            size_t length = std::char_traits<char>::length(word);
+            if (text_.compare(position_, length, word) != 0)
+                return false;
+            position_ += length;
+            return true;
+        }
+
+        void expect(char c)
+        {
+            if (!consume(c))
+                fail(std::string("expected '") + c + "'");
+        }
+
+        [[noreturn]] void fail(const std::string& message) const
+        {
+            throw std::runtime_error("JSON parse error at offset " + std::to_string(position_) + ": " + message);
+        }
+
+        const std::string& text_;
+        size_t position_ = 0;
+    };
+
+    JsonValue loadJson(const std::string& path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        if (!in.is_open())
+            throw std::invalid_argument("Failed to open benchmark results: " + path);
+        std::stringstream buffer;
+        buffer << in.rdbuf();
+        const std::string text = buffer.str();
+        return JsonParser(text).parseDocument();
+    }
+
+    // ========================================================================
+    // Benchmark results
+    // ========================================================================
+
+    struct Throughput
+    {
+        double value = 0;
+        std::string unit;
+        std::string error;      ///< Non-empty when the benchmark reported an error
+    };
+
+    double nanosecondsPerUnit(const std::string& timeUnit)
+    {
+        if (timeUnit == "us")
+            return 1e3;
+        if (timeUnit == "ms")
+            return 1e6;
+        if (timeUnit == "s")
+            return 1e9;
+        return 1;
+    }
+
+    Throughput throughputOf(const JsonValue& run)
+    {
+        const JsonValue* errorOccurred = run.find("error_occurred");
+        std::string error = run.stringOr("error_message", "");
+        if (error.empty() && errorOccurred != nullptr && errorOccurred->boolean)
+            error = "error";
+        if (!error.empty())
+            return {0, "", error};
+
+        double bytes = run.numberOr("bytes_per_second", 0);
+        if (bytes > 0)
+            return {bytes, "B/s", ""};
+        double items = run.numberOr("items_per_second", 0);
+        if (items > 0)
+            return {items, "items/s", ""};
+
+        double nanoseconds = run.numberOr("real_time", 0) * nanosecondsPerUnit(run.stringOr("time_unit", "ns"));
+        return {nanoseconds > 0 ? 1e9 / nanoseconds : 0, "runs/s", ""};
+    }
+
+    /**
+     * @brief Throughput per benchmark; a median aggregate replaces individual repetitions
+     */
+    std::map<std::string, Throughput> loadResults(const JsonValue& document, const std::string& path)
+    {
+        const JsonValue* benchmarks = document.find("benchmarks");
+        if (benchmarks == nullptr || benchmarks->type != JsonValue::Type::Array)
+            throw std::runtime_error("No \"benchmarks\" array in " + path);
+
+        std::map<std::string, Throughput> results;
+        std::map<std::string, bool> fromMedian;
+        std::set<std::string> failed;
+        for (const JsonValue& run : benchmarks->items)
+        {
+            const std::string name = run.stringOr("run_name", run.stringOr("name", ""));
+            const bool aggregate = run.stringOr("run_type", "iteration") == "aggregate";
+            if (aggregate && run.stringOr("aggregate_name", "") != "median")
+                continue;
+            if (!aggregate && fromMedian[name])
+                continue;
+
+            // An errored repetition marks the whole benchmark as failed
+            if (failed.count(name) != 0)
+                continue;
+            results[name] = throughputOf(run);
+            fromMedian[name] = aggregate;
+            if (!results[name].error.empty())
+                failed.insert(name);
+        }
+        return results;
+    }
+
+    /**
+     * @brief Build types from the context block: ours (passed with --benchmark_context
+     *        by benchmarks/CMakeLists.txt) and Google Benchmark's library_build_type
+     */
+    std::string buildTypesOf(const JsonValue& document)
+    {
+        static const JsonValue empty;
+        const JsonValue* context = document.find("context");
+        if (context == nullptr)
+            context = &empty;
+        return "build_type=" + context->stringOr("build_type", "unknown") +
+               ", library_build_type=" + context->stringOr("library_build_type", "unknown");
+    }
+
+    // ========================================================================
+    // Report
+    // ========================================================================
+
+    std::string formatRate(const Throughput& throughput)
+    {
+        if (!throughput.error.empty())
+            return "error";
+        static const char* const prefixes[] = {"", "k", "M", "G", "T"};
+        double value = throughput.value;
+        size_t prefix = 0;
+        while (value >= 1000 && prefix + 1 < std::size(prefixes))
+        {
+            value /= 1000;
+            ++prefix;
+        }
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(2) << value << " " << prefixes[prefix] << throughput.unit;
+        return out.str();
+    }
+
+    std::string formatChange(double percent)
+    {
+        std::ostringstream out;
+        out << std::showpos << std::fixed << std::setprecision(1) << percent << "%";
+        return out.str();
+    }
+
+    struct Failures
+    {
+        size_t regressions = 0;
+        size_t missing = 0;
+        size_t errors = 0;
+        bool buildMismatch = false;
+        bool allowMissing = false;
+
+        size_t total() const
+        {
+            return regressions + errors + (allowMissing ? 0 : missing) + (buildMismatch ? 1 : 0);
+        }
+    };
+
+    /**
+     * @brief Status column for one benchmark present in both files; counts failures
+     */
+    std::string statusOf(const Throughput& before, const Throughput& after, double change, double threshold,
+                         Failures& failures)
+    {
+        if (!after.error.empty())
+        {
+            ++failures.errors;
+            return "ERROR: " + after.error;
+        }
+        if (!before.error.empty())
+            return "baseline error";
+        if (after.unit == before.unit && change < -threshold)
+        {
+            ++failures.regressions;
+            return "REGRESSION";
+        }
+        return change > threshold ? "faster" : "ok";
+    }
+
+    int compare(const std::string& baselinePath, const std::string& currentPath, double threshold, bool allowMissing)
+    {
+        const JsonValue baselineDocument = loadJson(baselinePath);
+        const JsonValue currentDocument = loadJson(currentPath);
+        const auto baseline = loadResults(baselineDocument, baselinePath);
+        const auto current = loadResults(currentDocument, currentPath);
+
+        size_t nameWidth = 9;
+        for (const auto& entry : baseline)
+            nameWidth = std::max(nameWidth, entry.first.size());
+        for (const auto& entry : current)
+            nameWidth = std::max(nameWidth, entry.first.size());
+
+        std::cout << std::left << std::setw(static_cast<int>(nameWidth)) << "Benchmark" << std::right
+                  << std::setw(18) << "Baseline" << std::setw(18) << "Current" << std::setw(10) << "Change"
+                  << "  Status\n"
+                  << std::string(nameWidth + 54, '-') << "\n";
+
+        Failures failures;
+        failures.allowMissing = allowMissing;
+
+        // Timings from differently optimized builds are not comparable, whatever the table says
+        const std::string baselineBuild = buildTypesOf(baselineDocument);
+        const std::string currentBuild = buildTypesOf(currentDocument);
+        failures.buildMismatch = baselineBuild != currentBuild;
+        for (const auto& [name, before] : baseline)
+        {
+            auto after = current.find(name);
+            std::cout << std::left << std::setw(static_cast<int>(nameWidth)) << name << std::right
+                      << std::setw(18) << formatRate(before);
+            if (after == current.end())
+            {
+                ++failures.missing;
+                std::cout << std::setw(18) << "-" << std::setw(10) << "-" << (allowMissing ? "  missing\n" : "  MISSING\n");
+                continue;
+            }
+
+            const bool comparable = before.error.empty() && after->second.error.empty() && before.value > 0;
+            double change = comparable ? (after->second.value - before.value) / before.value * 100 : 0;
+            std::cout << std::setw(18) << formatRate(after->second) << std::setw(10)
+                      << (comparable ? formatChange(change) : "-")
+                      << "  " << statusOf(before, after->second, change, threshold, failures) << "\n";
+        }
+
+        for (const auto& [name, after] : current)
+        {
+            if (baseline.count(name) != 0)
+                continue;
+            failures.errors += after.error.empty() ? 0 : 1;
+            std::cout << std::left << std::setw(static_cast<int>(nameWidth)) << name << std::right
+                      << std::setw(18) << "-" << std::setw(18) << formatRate(after) << std::setw(10) << "-"
+                      << (after.error.empty() ? "  new\n" : "  ERROR: " + after.error + "\n");
+        }
+
+        std::cout << "\n" << failures.regressions << " regression(s) beyond " << threshold << "% throughput loss, "
+                  << failures.errors << " errored, " << failures.missing << " missing from the current run"
+                  << (allowMissing && failures.missing != 0 ? " (allowed)\n" : "\n");
+        if (failures.buildMismatch)
+            std::cout << "BUILD MISMATCH: baseline has " << baselineBuild << ", current run has " << currentBuild
+                      << "; re-record the baseline with this build\n";
+        return failures.total() == 0 ? 0 : 1;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<std::string> paths;
+    double threshold = 10;
+    bool allowMissing = false;
+    const std::string thresholdFlag = "--threshold=";
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string argument = argv[i];
+        if (argument.rfind(thresholdFlag, 0) == 0)
+            threshold = std::atof(argument.c_str() + thresholdFlag.size());
+        else if (argument == "--allow-missing")
+            allowMissing = true;
+        else
+            paths.push_back(argument);
+    }
+
+    if (paths.size() != 2 || threshold < 0)
+    {
+        std::cerr << "usage: stevensFileLib_benchmark_compare <baseline.json> <current.json> [--threshold=PERCENT]"
+                     " [--allow-missing]\n";
+        return 2;
+    }
+
+    try
+    {
+        return compare(paths[0], paths[1], threshold, allowMissing);
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << "error: " << error.what() << "\n";
+        return 2;
+    }
+}
@@ -0,0 +1,124 @@
+#include "stevensFileLib.hpp"
+#include "benchmark_support.hpp"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+
+namespace fs = std::filesystem;
+
+// ============================================================================
+// Concurrency scaling
+//
+// Each benchmark runs the same call from 1 to 8 threads at once. The per_thread
+// counter is calls per second achieved by an average thread; items_per_second is
+// the aggregate rate. Flat per_thread numbers as threads grow mean no contention.
+// ============================================================================
+
+namespace
+{
+    /**
+     * @brief Reports per-thread and aggregate call rates, plus bytes when the call moves file data
+     */
+    void reportConcurrentRate(benchmark::State& state, int64_t bytesPerCall = 0)
+    {
+        const auto calls = static_cast<double>(state.iterations());
+        state.counters["per_thread"] = benchmark::Counter(calls, benchmark::Counter::kAvgThreadsRate);
+        state.SetItemsProcessed(state.iterations());
+        if (bytesPerCall > 0)
+            state.SetBytesProcessed(state.iterations() * bytesPerCall);
+    }
+
+    /**
+     * @brief Append targets live in a subdirectory so they never show up in listFiles benchmarks
+     */
+    std::string appendTarget(const std::string& name)
+    {
+        fs::create_directories("benchmark_data/concurrent");
+        return "benchmark_data/concurrent/" + name;
+    }
+
+    void threadCounts(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->ThreadRange(1, 8)->UseRealTime();
+    }
+}
+
+// ============================================================================
+// appendToFile
+// ============================================================================
+
+static void Concurrent_AppendToFile_SameFile(benchmark::State& state)
+{
+    const std::string testFile = appendTarget("append_shared.txt");
+    const std::string content = "test line\n";
+
+    for (auto _ : state)
+        stevensFileLib::appendToFile(testFile, content);
+
+    reportConcurrentRate(state, static_cast<int64_t>(content.size()));
+}
+BENCHMARK(Concurrent_AppendToFile_SameFile)->Apply(threadCounts);
+
+static void Concurrent_AppendToFile_DifferentFiles(benchmark::State& state)
+{
+    const std::string testFile = appendTarget("append_" + std::to_string(state.thread_index()) + ".txt");
+    const std::string content = "test line\n";
+
+    for (auto _ : state)
+        stevensFileLib::appendToFile(testFile, content);
+
+    reportConcurrentRate(state, static_cast<int64_t>(content.size()));
+}
+BENCHMARK(Concurrent_AppendToFile_DifferentFiles)->Apply(threadCounts);
+
+// ============================================================================
+// Reading
+// ============================================================================
+
+static void Concurrent_LoadFileIntoVector_MediumFile(benchmark::State& state)
+{
+    const std::string path = "benchmark_data/medium.txt";
+
+    for (auto _ : state)
+    {
+        auto lines = stevensFileLib::loadFileIntoVector(path);
+        benchmark::DoNotOptimize(lines);
+    }
+
+    reportConcurrentRate(state, static_cast<int64_t>(fs::file_size(path)));
+}
+BENCHMARK(Concurrent_LoadFileIntoVector_MediumFile)->Apply(threadCounts);
+
+static void Concurrent_GetRandomFileLine_MediumFile(benchmark::State& state)
+{
+    const std::string path = "benchmark_data/medium.txt";
+
+    for (auto _ : state)
+    {
+        auto line = stevensFileLib::getRandomFileLine(path);
+        benchmark::DoNotOptimize(line);
+    }
+
+    reportConcurrentRate(state, static_cast<int64_t>(fs::file_size(path)));
+}
+BENCHMARK(Concurrent_GetRandomFileLine_MediumFile)->Apply(threadCounts);
+
+// ============================================================================
+// listFiles
+// ============================================================================
+
+static void Concurrent_ListFiles_WithTargetExtension(benchmark::State& state)
+{
+    std::unordered_map<std::string, std::string> settings;
+    settings["targetFileExtensions"] = ".txt";
+
+    for (auto _ : state)
+    {
+        auto files = stevensFileLib::listFiles("benchmark_data", settings);
+        benchmark::DoNotOptimize(files);
+    }
+
+    reportConcurrentRate(state);
+}
+BENCHMARK(Concurrent_ListFiles_WithTargetExtension)->Apply(threadCounts);
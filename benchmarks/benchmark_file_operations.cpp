@@ -1,4 +1,5 @@
 #include "stevensFileLib.hpp"
+#include "benchmark_support.hpp"
 #include <benchmark/benchmark.h>
 #include <filesystem>
 #include <fstream>
@@ -74,6 +75,14 @@ private:
     }
 };
 
+/**
+ * @brief Reports MB/s and lines/s for a benchmark that processes a whole file per iteration
+ */
+static void ReportFileThroughput(benchmark::State& state, const std::string& path, int64_t lineCount)
+{
+    benchmarkSupport::setThroughput(state, static_cast<int64_t>(fs::file_size(path)), lineCount);
+}
+
 // ============================================================================
 // Benchmarks for loadFileIntoVector
 // ============================================================================
@@ -85,6 +94,8 @@ static void LoadFileIntoVector_SmallFile(benchmark::State& state)
         auto lines = stevensFileLib::loadFileIntoVector("benchmark_data/small.txt");
         benchmark::DoNotOptimize(lines);
     }
+
+    ReportFileThroughput(state, "benchmark_data/small.txt", 100);
 }
 BENCHMARK(LoadFileIntoVector_SmallFile);
 
@@ -95,6 +106,8 @@ static void LoadFileIntoVector_MediumFile(benchmark::State& state)
         auto lines = stevensFileLib::loadFileIntoVector("benchmark_data/medium.txt");
         benchmark::DoNotOptimize(lines);
     }
+
+    ReportFileThroughput(state, "benchmark_data/medium.txt", 10000);
 }
 BENCHMARK(LoadFileIntoVector_MediumFile);
 
@@ -105,6 +118,8 @@ static void LoadFileIntoVector_LargeFile(benchmark::State& state)
         auto lines = stevensFileLib::loadFileIntoVector("benchmark_data/large.txt");
         benchmark::DoNotOptimize(lines);
     }
+
+    ReportFileThroughput(state, "benchmark_data/large.txt", 1000000);
 }
 BENCHMARK(LoadFileIntoVector_LargeFile);
 
@@ -119,9 +134,39 @@ static void LoadFileIntoVector_WithFiltering(benchmark::State& state)
         auto lines = stevensFileLib::loadFileIntoVector("benchmark_data/medium.txt", settings);
         benchmark::DoNotOptimize(lines);
     }
+
+    ReportFileThroughput(state, "benchmark_data/medium.txt", 10000);
 }
 BENCHMARK(LoadFileIntoVector_WithFiltering);
 
+// ============================================================================
+// Benchmarks for loadFileIntoHashSet / loadFileIntoSortedSet
+// ============================================================================
+
+static void LoadFileIntoHashSet_MediumFile(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto set = stevensFileLib::loadFileIntoHashSet("benchmark_data/medium.txt");
+        benchmark::DoNotOptimize(set);
+    }
+
+    ReportFileThroughput(state, "benchmark_data/medium.txt", 10000);
+}
+BENCHMARK(LoadFileIntoHashSet_MediumFile);
+
+static void LoadFileIntoSortedSet_MediumFile(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto set = stevensFileLib::loadFileIntoSortedSet("benchmark_data/medium.txt");
+        benchmark::DoNotOptimize(set);
+    }
+
+    ReportFileThroughput(state, "benchmark_data/medium.txt", 10000);
+}
+BENCHMARK(LoadFileIntoSortedSet_MediumFile);
+
 // ============================================================================
 // Benchmarks for loadFileIntoVectorOfInts
 // ============================================================================
@@ -133,6 +178,8 @@ static void LoadFileIntoVectorOfInts(benchmark::State& state)
         auto numbers = stevensFileLib::loadFileIntoVectorOfInts("benchmark_data/integers.txt");
         benchmark::DoNotOptimize(numbers);
     }
+
+    ReportFileThroughput(state, "benchmark_data/integers.txt", 10000);
 }
 BENCHMARK(LoadFileIntoVectorOfInts);
 
@@ -175,6 +222,40 @@ static void AppendToFile_LargeContent(benchmark::State& state)
 }
 BENCHMARK(AppendToFile_LargeContent);
 
+// ============================================================================
+// Benchmarks for writeLinesToFile / writeFileAtomic
+// ============================================================================
+
+static void WriteLinesToFile_LargeFile(benchmark::State& state)
+{
+    std::string testFile = "benchmark_data/write_lines_test.txt";
+    auto lines = stevensFileLib::loadFileIntoVector("benchmark_data/large.txt");
+
+    for (auto _ : state)
+    {
+        stevensFileLib::writeLinesToFile(testFile, lines);
+    }
+
+    ReportFileThroughput(state, testFile, 1000000);
+    fs::remove(testFile);
+}
+BENCHMARK(WriteLinesToFile_LargeFile);
+
+static void WriteLinesAtomic_MediumFile(benchmark::State& state)
+{
+    std::string testFile = "benchmark_data/write_atomic_test.txt";
+    auto lines = stevensFileLib::loadFileIntoVector("benchmark_data/medium.txt");
+
+    for (auto _ : state)
+    {
+        stevensFileLib::writeLinesAtomic(testFile, lines);
+    }
+
+    ReportFileThroughput(state, testFile, 10000);
+    fs::remove(testFile);
+}
+BENCHMARK(WriteLinesAtomic_MediumFile);
+
 // ============================================================================
 // Benchmarks for getRandomFileLine
 // ============================================================================
@@ -186,6 +267,8 @@ static void GetRandomFileLine_SmallFile(benchmark::State& state)
         auto line = stevensFileLib::getRandomFileLine("benchmark_data/small.txt");
         benchmark::DoNotOptimize(line);
     }
+
+    ReportFileThroughput(state, "benchmark_data/small.txt", 100);
 }
 BENCHMARK(GetRandomFileLine_SmallFile);
 
@@ -196,6 +279,8 @@ static void GetRandomFileLine_MediumFile(benchmark::State& state)
         auto line = stevensFileLib::getRandomFileLine("benchmark_data/medium.txt");
         benchmark::DoNotOptimize(line);
     }
+
+    ReportFileThroughput(state, "benchmark_data/medium.txt", 10000);
 }
 BENCHMARK(GetRandomFileLine_MediumFile);
 
@@ -253,6 +338,65 @@ static void ListFiles_WithMultipleFilters(benchmark::State& state)
 }
 BENCHMARK(ListFiles_WithMultipleFilters);
 
+static void ListFiles_FindFirstMatch(benchmark::State& state)
+{
+    std::unordered_map<std::string, std::string> settings;
+    settings["targetFileExtensions"] = ".hpp";
+
+    for (auto _ : state)
+    {
+        auto files = stevensFileLib::listFiles("benchmark_data", settings);
+        benchmark::DoNotOptimize(files.empty() ? std::string() : files.front());
+    }
+}
+BENCHMARK(ListFiles_FindFirstMatch);
+
+static void DirectoryRange_FindFirstMatch(benchmark::State& state)
+{
+    stevensFileLib::ListFilesSettings settings;
+    settings.targetExtensions = {".hpp"};
+
+    for (auto _ : state)
+    {
+        stevensFileLib::DirectoryRange range("benchmark_data", settings);
+        auto first = range.begin();
+        benchmark::DoNotOptimize(first == range.end() ? std::string() : first->path().filename().string());
+    }
+}
+BENCHMARK(DirectoryRange_FindFirstMatch);
+
+static void ListFilesPage_FirstPage(benchmark::State& state)
+{
+    stevensFileLib::ListPageOptions options;
+    options.limit = 100;
+    options.sortBy = static_cast<stevensFileLib::ListSortKey>(state.range(0));
+
+    for (auto _ : state)
+    {
+        auto page = stevensFileLib::listFilesPage("benchmark_data", options);
+        benchmark::DoNotOptimize(page);
+    }
+}
+BENCHMARK(ListFilesPage_FirstPage)->ArgName("sort")->DenseRange(0, 3);
+
+// ============================================================================
+// Benchmarks for loadDirectory
+// ============================================================================
+
+static void LoadDirectory_SmallFiles(benchmark::State& state)
+{
+    std::unordered_map<std::string, std::string> settings;
+    settings["targetFileExtensions"] = ".cpp,.hpp";
+
+    for (auto _ : state)
+    {
+        auto files = stevensFileLib::loadDirectory("benchmark_data", settings, {},
+                                                   static_cast<size_t>(state.range(0)));
+        benchmark::DoNotOptimize(files);
+    }
+}
+BENCHMARK(LoadDirectory_SmallFiles)->Arg(1)->Arg(4)->UseRealTime();
+
 // ============================================================================
 // Main function with setup and teardown
 // ============================================================================
@@ -261,11 +405,21 @@ int main(int argc, char** argv)
 {
     FileOperationsBenchmark::SetupTestFiles();
 
+    // Checked before Initialize() strips the benchmark flags from argv
+    const bool consoleFormat = benchmarkSupport::usesConsoleFormat(argc, argv);
     benchmark::Initialize(&argc, argv);
     if (benchmark::ReportUnrecognizedArguments(argc, argv))
         return 1;
 
-    benchmark::RunSpecifiedBenchmarks();
+    if (consoleFormat)
+    {
+        benchmarkSupport::BaselineRatioReporter reporter(benchmarkSupport::consoleOutputOptions());
+        benchmark::RunSpecifiedBenchmarks(&reporter);
+    }
+    else
+    {
+        benchmark::RunSpecifiedBenchmarks();
+    }
     benchmark::Shutdown();
 
     FileOperationsBenchmark::CleanupTestFiles();
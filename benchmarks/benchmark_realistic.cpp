@@ -0,0 +1,205 @@
+#include "stevensFileLib.hpp"
+#include "benchmark_support.hpp"
+#include "dataset_generator.hpp"
+#include <benchmark/benchmark.h>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// ============================================================================
+// Realistic datasets
+//
+// The other suites read files of identical, pure-ASCII lines. These benchmarks use
+// seeded datasets with variable line lengths, multi-byte UTF-8, comment and blank
+// lines, CRLF endings and directories of mixed file types, so branch prediction
+// and allocation patterns look more like production input.
+// ============================================================================
+
+namespace
+{
+    using datasetGenerator::LengthDistribution;
+
+    struct RealisticFile
+    {
+        std::string path;
+        datasetGenerator::GeneratedStats stats;
+    };
+
+    /**
+     * @brief Generates a dataset file on first use and reuses it for later benchmarks
+     */
+    const RealisticFile& realisticFile(const std::string& name, const datasetGenerator::FileSpec& spec)
+    {
+        static std::mutex mutex;
+        static std::map<std::string, RealisticFile> files;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto found = files.find(name);
+        if (found != files.end())
+            return found->second;
+
+        benchmarkSupport::fs::create_directories("benchmark_data/generated");
+        RealisticFile file;
+        file.path = "benchmark_data/generated/realistic_" + name + ".txt";
+        file.stats = datasetGenerator::generateFile(file.path, spec);
+        return files.emplace(name, std::move(file)).first->second;
+    }
+
+    /**
+     * @brief Generates a directory of files once; listFiles is not recursive, so the tree is flat
+     */
+    const datasetGenerator::GeneratedStats& realisticDirectory()
+    {
+        static const datasetGenerator::GeneratedStats stats = []
+        {
+            datasetGenerator::DirectorySpec spec;
+            spec.fileCount = 1000;
+            spec.depth = 0;
+            return datasetGenerator::generateDirectoryTree("benchmark_data/generated/realistic_tree", spec);
+        }();
+        return stats;
+    }
+
+    const char* distributionName(LengthDistribution distribution)
+    {
+        switch (distribution)
+        {
+        case LengthDistribution::Fixed:
+            return "fixed";
+        case LengthDistribution::Uniform:
+            return "uniform";
+        case LengthDistribution::Normal:
+            return "normal";
+        case LengthDistribution::LogNormal:
+            return "lognormal";
+        }
+        return "unknown";
+    }
+
+    /**
+     * @brief 200,000 lines averaging 60 bytes with the given length distribution
+     */
+    datasetGenerator::FileSpec mixedSpec(LengthDistribution distribution)
+    {
+        datasetGenerator::FileSpec spec;
+        spec.lineCount = 200000;
+        spec.distribution = distribution;
+        spec.minLength = 0;
+        spec.maxLength = 120;
+        return spec;
+    }
+
+    void reportRealisticThroughput(benchmark::State& state, const datasetGenerator::GeneratedStats& stats)
+    {
+        benchmarkSupport::setThroughput(state, static_cast<int64_t>(stats.bytes), static_cast<int64_t>(stats.lines));
+    }
+
+    void distributionArguments(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->ArgName("distribution");
+        for (LengthDistribution distribution : {LengthDistribution::Fixed, LengthDistribution::Uniform,
+                                                LengthDistribution::Normal, LengthDistribution::LogNormal})
+            benchmark->Arg(static_cast<int64_t>(distribution));
+        benchmark->Unit(benchmark::kMillisecond);
+    }
+}
+
+// ============================================================================
+// Line length distributions
+// ============================================================================
+
+static void Realistic_LoadFileIntoVector_Distribution(benchmark::State& state)
+{
+    const auto distribution = static_cast<LengthDistribution>(state.range(0));
+    const RealisticFile& file = realisticFile(distributionName(distribution), mixedSpec(distribution));
+    state.SetLabel(distributionName(distribution));
+
+    for (auto _ : state)
+    {
+        auto lines = stevensFileLib::loadFileIntoVector(file.path);
+        benchmark::DoNotOptimize(lines);
+    }
+
+    reportRealisticThroughput(state, file.stats);
+}
+BENCHMARK(Realistic_LoadFileIntoVector_Distribution)->Apply(distributionArguments);
+
+static void Realistic_LineReader_Distribution(benchmark::State& state)
+{
+    const auto distribution = static_cast<LengthDistribution>(state.range(0));
+    const RealisticFile& file = realisticFile(distributionName(distribution), mixedSpec(distribution));
+    state.SetLabel(distributionName(distribution));
+
+    for (auto _ : state)
+    {
+        stevensFileLib::LineReader reader(file.path);
+        std::string_view line;
+        size_t bytes = 0;
+        while (reader.next(line))
+            bytes += line.size();
+        benchmark::DoNotOptimize(bytes);
+    }
+
+    reportRealisticThroughput(state, file.stats);
+}
+BENCHMARK(Realistic_LineReader_Distribution)->Apply(distributionArguments);
+
+// ============================================================================
+// Config-style files: comments, blank lines, CRLF
+// ============================================================================
+
+static void Realistic_LoadFileIntoVector_CommentsCrlf(benchmark::State& state)
+{
+    datasetGenerator::FileSpec spec = mixedSpec(LengthDistribution::LogNormal);
+    spec.commentRatio = 0.3;
+    spec.emptyLineRatio = 0.1;
+    spec.utf8Ratio = 0.3;
+    spec.crlf = true;
+    const RealisticFile& file = realisticFile("config_crlf", spec);
+
+    std::unordered_map<std::string, std::vector<std::string>> settings;
+    settings["skip if starts with"] = {"#"};
+
+    for (auto _ : state)
+    {
+        auto lines = stevensFileLib::loadFileIntoVector(file.path, settings);
+        benchmark::DoNotOptimize(lines);
+    }
+
+    reportRealisticThroughput(state, file.stats);
+}
+BENCHMARK(Realistic_LoadFileIntoVector_CommentsCrlf)->Unit(benchmark::kMillisecond);
+
+// ============================================================================
+// Directories of mixed file types
+// ============================================================================
+
+static void Realistic_ListFiles_MixedExtensions(benchmark::State& state)
+{
+    realisticDirectory();
+    std::unordered_map<std::string, std::string> settings;
+    settings["targetFileExtensions"] = ".txt,.log";
+
+    for (auto _ : state)
+    {
+        auto files = stevensFileLib::listFiles("benchmark_data/generated/realistic_tree", settings);
+        benchmark::DoNotOptimize(files);
+    }
+}
+BENCHMARK(Realistic_ListFiles_MixedExtensions);
+
+static void Realistic_LoadDirectory_MixedExtensions(benchmark::State& state)
+{
+    const datasetGenerator::GeneratedStats& stats = realisticDirectory();
+
+    for (auto _ : state)
+    {
+        auto files = stevensFileLib::loadDirectory("benchmark_data/generated/realistic_tree");
+        benchmark::DoNotOptimize(files);
+    }
+
+    reportRealisticThroughput(state, stats);
+}
+BENCHMARK(Realistic_LoadDirectory_MixedExtensions)->UseRealTime()->Unit(benchmark::kMillisecond);
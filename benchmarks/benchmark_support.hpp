@@ -0,0 +1,260 @@
+#ifndef STEVENS_FILE_LIB_BENCHMARK_SUPPORT_HPP
+#define STEVENS_FILE_LIB_BENCHMARK_SUPPORT_HPP
+
+#include <benchmark/benchmark.h>
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+// ============================================================================
+// Shared helpers for the benchmark translation units
+// ============================================================================
+
+namespace benchmarkSupport
+{
+    namespace fs = std::filesystem;
+
+    constexpr int64_t KiB = 1024;
+    constexpr int64_t MiB = 1024 * KiB;
+    constexpr int64_t GiB = 1024 * MiB;
+
+    /**
+     * @brief True when STEVENS_FILE_LIB_BENCH_LARGE is set, enabling the multi-GiB file sizes
+     */
+    inline bool largeSizesEnabled()
+    {
+        const char* value = std::getenv("STEVENS_FILE_LIB_BENCH_LARGE");
+        return value != nullptr && *value != '\0' && *value != '0';
+    }
+
+    /**
+     * @brief Reports bytes and lines handled per iteration as MB/s and lines/s counters
+     */
+    inline void setThroughput(benchmark::State& state, int64_t bytesPerIteration, int64_t linesPerIteration)
+    {
+        state.SetBytesProcessed(state.iterations() * bytesPerIteration);
+        state.SetItemsProcessed(state.iterations() * linesPerIteration);
+    }
+
+    /**
+     * @brief Evicts a file from the page cache so the next read comes from the device
+     *
+     * Best effort: dirty pages are flushed first, since the kernel only drops clean ones.
+     * This does nothing on platforms without posix_fadvise.
+     */
+    inline void dropPageCache(const std::string& path)
+    {
+#if defined(POSIX_FADV_DONTNEED)
+        int descriptor = ::open(path.c_str(), O_RDONLY);
+        if (descriptor < 0)
+            return;
+        ::fdatasync(descriptor);
+        ::posix_fadvise(descriptor, 0, 0, POSIX_FADV_DONTNEED);
+        ::close(descriptor);
+#else
+        (void)path;
+#endif
+    }
+
+    /**
+     * @brief Shape of a generated line file
+     */
+    struct LineFileShape
+    {
+        int64_t lineLength = 64;        ///< Bytes per line, excluding the separator
+        int64_t totalBytes = 16 * MiB;  ///< Approximate file size
+        char separator = '\n';
+    };
+
+    /**
+     * @brief A generated file and the counts needed to report throughput
+     */
+    struct LineFile
+    {
+        std::string path;
+        int64_t bytes = 0;
+        int64_t lines = 0;
+    };
+
+    /**
+     * @brief Generates line files on first use and reuses them across benchmarks
+     *
+     * Files live under benchmark_data/generated, which the benchmark main removes on exit.
+     */
+    class GeneratedFiles
+    {
+    public:
+        static const LineFile& get(const LineFileShape& shape)
+        {
+            static std::mutex mutex;
+            static std::map<std::tuple<int64_t, int64_t, char>, LineFile> files;
+
+            std::lock_guard<std::mutex> lock(mutex);
+            auto key = std::make_tuple(shape.lineLength, shape.totalBytes, shape.separator);
+            auto found = files.find(key);
+            if (found != files.end())
+                return found->second;
+            return files.emplace(key, create(shape)).first->second;
+        }
+
+    private:
+        static LineFile create(const LineFileShape& shape)
+        {
+            fs::create_directories("benchmark_data/generated");
+
+            LineFile file;
+            file.path = "benchmark_data/generated/lines_" + std::to_string(shape.lineLength) + "_" +
+                        std::to_string(shape.totalBytes) + "_" +
+                        std::to_string(static_cast<int>(static_cast<unsigned char>(shape.separator))) + ".txt";
+
+            const std::string base = makeLine(shape.lineLength) + shape.separator;
+            std::string line = base;
+
+            // Each line starts with its number so set and map loaders see distinct keys
+            std::ofstream out(file.path, std::ios::binary);
+            for (; file.bytes < shape.totalBytes; ++file.lines)
+            {
+                line = base;
+                std::to_chars(line.data(), line.data() + shape.lineLength, file.lines);
+                out.write(line.data(), static_cast<std::streamsize>(line.size()));
+                file.bytes += static_cast<int64_t>(line.size());
+            }
+            return file;
+        }
+
+        static std::string makeLine(int64_t length)
+        {
+            static const char alphabet[] = "abcdefghijklmnopqrstuvwxyz 0123456789";
+            std::string line(static_cast<size_t>(length), ' ');
+            for (size_t i = 0; i < line.size(); ++i)
+                line[i] = alphabet[(i * 7 + 3) % (sizeof(alphabet) - 1)];
+            return line;
+        }
+    };
+
+    // ========================================================================
+    // Baseline ratios
+    // ========================================================================
+
+    /**
+     * @brief Library benchmark paired with the raw implementation it is measured against
+     */
+    struct BaselinePair
+    {
+        std::string library;
+        std::string baseline;
+    };
+
+    inline std::vector<BaselinePair>& baselinePairs()
+    {
+        static std::vector<BaselinePair> pairs;
+        return pairs;
+    }
+
+    /**
+     * @brief Registers a pair at static-initialization time; returns a dummy for namespace-scope use
+     */
+    inline bool registerBaselinePair(std::string library, std::string baseline)
+    {
+        baselinePairs().push_back({std::move(library), std::move(baseline)});
+        return true;
+    }
+
+    /**
+     * @brief Console reporter that ends the run with library-time / baseline-time ratios
+     *
+     * A ratio of 1.00x means the library call matches the raw POSIX implementation; pairs
+     * where either side was filtered out of the run are omitted. With repetitions the
+     * median aggregate is used, like stevensFileLib_benchmark_compare.
+     */
+    class BaselineRatioReporter : public benchmark::ConsoleReporter
+    {
+    public:
+        explicit BaselineRatioReporter(OutputOptions options) : benchmark::ConsoleReporter(options) {}
+
+        void ReportRuns(const std::vector<Run>& runs) override
+        {
+            for (const Run& run : runs)
+            {
+                const std::string name = run.run_name.str();
+                const bool median = run.run_type == Run::RT_Aggregate && run.aggregate_name == "median";
+                if (median)
+                    fromMedian_.insert(name);
+                else if (run.run_type != Run::RT_Iteration || run.iterations == 0 || fromMedian_.count(name) != 0)
+                    continue;
+
+                secondsPerIteration_[name] = run.GetAdjustedRealTime() / benchmark::GetTimeUnitMultiplier(run.time_unit);
+            }
+            benchmark::ConsoleReporter::ReportRuns(runs);
+        }
+
+        void Finalize() override
+        {
+            std::ostream& out = GetOutputStream();
+            bool printedHeader = false;
+            for (const BaselinePair& pair : baselinePairs())
+            {
+                auto library = secondsPerIteration_.find(pair.library);
+                auto baseline = secondsPerIteration_.find(pair.baseline);
+                if (library == secondsPerIteration_.end() || baseline == secondsPerIteration_.end())
+                    continue;
+
+                if (!printedHeader)
+                    out << "\nRatio to baseline (real time, lower is better)\n";
+                printedHeader = true;
+                out << "  " << std::left << std::setw(44) << pair.library << " / " << std::setw(40) << pair.baseline << "  "
+                    << std::right << std::fixed << std::setprecision(2) << library->second / baseline->second << "x\n";
+            }
+            benchmark::ConsoleReporter::Finalize();
+        }
+
+    private:
+        std::map<std::string, double> secondsPerIteration_;
+        std::set<std::string> fromMedian_;  ///< Names whose median aggregate replaced the repetitions
+    };
+
+    /**
+     * @brief Colored console output on a terminal, plain text when redirected
+     */
+    inline benchmark::ConsoleReporter::OutputOptions consoleOutputOptions()
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        if (!::isatty(STDOUT_FILENO))
+            return benchmark::ConsoleReporter::OO_None;
+#endif
+        return benchmark::ConsoleReporter::OO_Color;
+    }
+
+    /**
+     * @brief True unless the command line selects a non-console output format
+     */
+    inline bool usesConsoleFormat(int argc, char** argv)
+    {
+        const std::string flag = "--benchmark_format=";
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string argument = argv[i];
+            if (argument.rfind(flag, 0) == 0 && argument.substr(flag.size()) != "console")
+                return false;
+        }
+        return true;
+    }
+}
+
+#endif // STEVENS_FILE_LIB_BENCHMARK_SUPPORT_HPP
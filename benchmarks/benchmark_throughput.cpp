@@ -0,0 +1,194 @@
+#include "stevensFileLib.hpp"
+#include "benchmark_support.hpp"
+#include <benchmark/benchmark.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace benchmarkSupport;
+
+// ============================================================================
+// Throughput sweeps
+//
+// Every benchmark here reports bytes_per_second and items_per_second (lines/s)
+// so results stay comparable across file shapes. Input files are generated on
+// first use; set STEVENS_FILE_LIB_BENCH_LARGE=1 to include the 1 GiB and 4 GiB sizes.
+// ============================================================================
+
+namespace
+{
+    enum class CacheState
+    {
+        Warm,
+        Cold
+    };
+
+    /**
+     * @brief Runs one load per iteration, evicting the file from the page cache untimed when cold
+     */
+    template <typename Load>
+    void runLoad(benchmark::State& state, const LineFile& file, CacheState cache, Load load)
+    {
+        for (auto _ : state)
+        {
+            if (cache == CacheState::Cold)
+            {
+                state.PauseTiming();
+                dropPageCache(file.path);
+                state.ResumeTiming();
+            }
+            load();
+        }
+        setThroughput(state, file.bytes, file.lines);
+    }
+
+    /**
+     * @brief Filter settings with the given number of rules, none of which match generated lines
+     */
+    std::unordered_map<std::string, std::vector<std::string>> makeFilters(int64_t ruleCount)
+    {
+        std::unordered_map<std::string, std::vector<std::string>> settings;
+        for (int64_t i = 0; i < ruleCount; ++i)
+        {
+            if (i % 2 == 0)
+                settings["skip if starts with"].push_back("#rule" + std::to_string(i));
+            else
+                settings["skip if contains"].push_back("SKIP" + std::to_string(i));
+        }
+        return settings;
+    }
+
+    stevensFileLib::ReadOptions memoryMapOptions()
+    {
+        stevensFileLib::ReadOptions options;
+        options.memoryMap = true;
+        return options;
+    }
+
+    void fileSizeArguments(benchmark::internal::Benchmark* benchmark)
+    {
+        for (int64_t size : {4 * KiB, 64 * KiB, 1 * MiB, 16 * MiB, 64 * MiB})
+            benchmark->Arg(size);
+        if (largeSizesEnabled())
+            benchmark->Arg(1 * GiB)->Arg(4 * GiB);
+    }
+}
+
+// ============================================================================
+// loadFileIntoVector: line length, file size, filters, separators
+// ============================================================================
+
+static void Throughput_LoadFileIntoVector_LineLength(benchmark::State& state)
+{
+    const LineFile& file = GeneratedFiles::get({state.range(0), 16 * MiB, '\n'});
+
+    runLoad(state, file, CacheState::Warm, [&]
+    {
+        auto lines = stevensFileLib::loadFileIntoVector(file.path);
+        benchmark::DoNotOptimize(lines);
+    });
+}
+BENCHMARK(Throughput_LoadFileIntoVector_LineLength)->RangeMultiplier(4)->Range(8, 8192)->Unit(benchmark::kMillisecond);
+
+static void Throughput_LoadFileIntoVector_FileSize(benchmark::State& state)
+{
+    const LineFile& file = GeneratedFiles::get({64, state.range(0), '\n'});
+
+    runLoad(state, file, CacheState::Warm, [&]
+    {
+        auto lines = stevensFileLib::loadFileIntoVector(file.path);
+        benchmark::DoNotOptimize(lines);
+    });
+}
+BENCHMARK(Throughput_LoadFileIntoVector_FileSize)->Apply(fileSizeArguments)->Unit(benchmark::kMicrosecond);
+
+static void Throughput_LoadFileIntoVector_FilterCount(benchmark::State& state)
+{
+    const LineFile& file = GeneratedFiles::get({64, 16 * MiB, '\n'});
+    auto settings = makeFilters(state.range(0));
+
+    runLoad(state, file, CacheState::Warm, [&]
+    {
+        auto lines = stevensFileLib::loadFileIntoVector(file.path, settings);
+        benchmark::DoNotOptimize(lines);
+    });
+}
+BENCHMARK(Throughput_LoadFileIntoVector_FilterCount)->Arg(0)->Arg(1)->Arg(4)->Arg(16)->Unit(benchmark::kMillisecond);
+
+static void Throughput_LoadFileIntoVector_Separator(benchmark::State& state)
+{
+    const char separator = static_cast<char>(state.range(0));
+    const LineFile& file = GeneratedFiles::get({64, 16 * MiB, separator});
+
+    runLoad(state, file, CacheState::Warm, [&]
+    {
+        auto lines = stevensFileLib::loadFileIntoVector(file.path, {}, separator);
+        benchmark::DoNotOptimize(lines);
+    });
+}
+BENCHMARK(Throughput_LoadFileIntoVector_Separator)
+    ->ArgName("separator")->Arg('\n')->Arg(',')->Arg('\t')->Arg('|')->Arg('\0')
+    ->Unit(benchmark::kMillisecond);
+
+// ============================================================================
+// Cold vs warm page cache, across the reading entry points
+// ============================================================================
+
+template <typename Load>
+static void Throughput_PageCache(benchmark::State& state, Load load)
+{
+    const LineFile& file = GeneratedFiles::get({64, 64 * MiB, '\n'});
+    const CacheState cache = state.range(0) == 0 ? CacheState::Warm : CacheState::Cold;
+    state.SetLabel(cache == CacheState::Warm ? "warm" : "cold");
+
+    runLoad(state, file, cache, [&] { load(file.path); });
+}
+
+#define THROUGHPUT_PAGE_CACHE(name, ...)                                                           \
+    BENCHMARK_CAPTURE(Throughput_PageCache, name, [](const std::string& path)                     \
+    {                                                                                             \
+        auto result = __VA_ARGS__;                                                                \
+        benchmark::DoNotOptimize(result);                                                         \
+    })->ArgName("cold")->Arg(0)->Arg(1)->UseRealTime()->Unit(benchmark::kMillisecond)
+
+THROUGHPUT_PAGE_CACHE(loadFileIntoVector, stevensFileLib::loadFileIntoVector(path));
+THROUGHPUT_PAGE_CACHE(loadFileIntoVector_memoryMap,
+                      stevensFileLib::loadFileIntoVector(path, {}, '\n', true, memoryMapOptions()));
+THROUGHPUT_PAGE_CACHE(loadFileIntoHashSet, stevensFileLib::loadFileIntoHashSet(path));
+THROUGHPUT_PAGE_CACHE(loadDelimitedFile, stevensFileLib::loadDelimitedFile(path));
+THROUGHPUT_PAGE_CACHE(getRandomFileLine, stevensFileLib::getRandomFileLine(path));
+
+static void Throughput_LineReader_PageCache(benchmark::State& state)
+{
+    const LineFile& file = GeneratedFiles::get({64, 64 * MiB, '\n'});
+    const CacheState cache = state.range(0) == 0 ? CacheState::Warm : CacheState::Cold;
+    state.SetLabel(cache == CacheState::Warm ? "warm" : "cold");
+
+    runLoad(state, file, cache, [&]
+    {
+        stevensFileLib::LineReader reader(file.path, {}, stevensFileLib::ReadOptions::streaming());
+        std::string_view line;
+        size_t bytes = 0;
+        while (reader.next(line))
+            bytes += line.size();
+        benchmark::DoNotOptimize(bytes);
+    });
+}
+BENCHMARK(Throughput_LineReader_PageCache)->ArgName("cold")->Arg(0)->Arg(1)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// ============================================================================
+// Writing: line length sweep
+// ============================================================================
+
+static void Throughput_WriteLinesToFile_LineLength(benchmark::State& state)
+{
+    const LineFile& file = GeneratedFiles::get({state.range(0), 16 * MiB, '\n'});
+    const auto lines = stevensFileLib::loadFileIntoVector(file.path);
+    const std::string target = "benchmark_data/generated/write_target.txt";
+
+    for (auto _ : state)
+        stevensFileLib::writeLinesToFile(target, lines);
+
+    setThroughput(state, file.bytes, file.lines);
+}
+BENCHMARK(Throughput_WriteLinesToFile_LineLength)->RangeMultiplier(8)->Range(8, 4096)->UseRealTime()->Unit(benchmark::kMillisecond);
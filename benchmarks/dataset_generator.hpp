@@ -0,0 +1,274 @@
+#ifndef STEVENS_FILE_LIB_DATASET_GENERATOR_HPP
+#define STEVENS_FILE_LIB_DATASET_GENERATOR_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// Seeded synthetic datasets for benchmarks
+//
+// Everything is derived from std::mt19937_64, whose output sequence is fixed by
+// the standard, through hand-written transforms (the <random> distributions are
+// implementation-defined). Fixed and Uniform line lengths use integer and
+// IEEE double arithmetic only, so the same spec and seed produce byte-identical
+// files on every platform. Normal and LogNormal lengths also call std::log,
+// std::cos and std::exp. Their last bits depend on the C math library, so those
+// files are only guaranteed identical on the same toolchain and libm.
+// ============================================================================
+
+namespace datasetGenerator
+{
+    namespace fs = std::filesystem;
+
+    enum class LengthDistribution
+    {
+        Fixed,      ///< Every line is meanLength bytes
+        Uniform,    ///< Uniform in [minLength, maxLength]
+        Normal,     ///< Normal(meanLength, standardDeviation), clamped to [minLength, maxLength]
+        LogNormal   ///< Long-tailed: median meanLength, shape from standardDeviation / meanLength
+    };
+
+    /**
+     * @brief Shape of one generated line file
+     */
+    struct FileSpec
+    {
+        uint64_t seed = 42;
+        size_t lineCount = 10000;
+        LengthDistribution distribution = LengthDistribution::LogNormal;
+        double meanLength = 60;
+        double standardDeviation = 40;
+        size_t minLength = 0;
+        size_t maxLength = 4096;
+        double utf8Ratio = 0.1;         ///< Fraction of words drawn from multi-byte UTF-8 text
+        double commentRatio = 0.05;     ///< Fraction of lines starting with commentPrefix
+        double emptyLineRatio = 0.02;
+        std::string commentPrefix = "#";
+        bool crlf = false;              ///< End lines with "\r\n" instead of "\n"
+    };
+
+    /**
+     * @brief Shape of a generated directory tree
+     *
+     * Directories form a tree with `fanout` children per directory down to `depth` levels
+     * below the root; `fileCount` files are spread round-robin over all of them.
+     */
+    struct DirectorySpec
+    {
+        uint64_t seed = 42;
+        size_t fileCount = 1000;
+        size_t depth = 2;
+        size_t fanout = 4;
+        std::vector<std::string> extensions = {".txt", ".log", ".csv", ".cpp", ".hpp"};
+        FileSpec file = smallFile();
+
+        static FileSpec smallFile()
+        {
+            FileSpec spec;
+            spec.lineCount = 20;
+            return spec;
+        }
+    };
+
+    /**
+     * @brief What a generator call wrote
+     */
+    struct GeneratedStats
+    {
+        size_t files = 0;
+        size_t directories = 0;
+        size_t lines = 0;
+        size_t commentLines = 0;
+        size_t emptyLines = 0;
+        uint64_t bytes = 0;
+    };
+
+    /**
+     * @brief Portable random source: mt19937_64 with fixed, platform-independent transforms
+     */
+    class Random
+    {
+    public:
+        explicit Random(uint64_t seed) : engine_(seed) {}
+
+        /// Uniform in [0, 1)
+        double unit() { return static_cast<double>(engine_() >> 11) * (1.0 / 9007199254740992.0); }
+
+        /// Uniform in [low, high]
+        size_t between(size_t low, size_t high)
+        {
+            if (high <= low)
+                return low;
+            return low + static_cast<size_t>(unit() * static_cast<double>(high - low + 1));
+        }
+
+        bool chance(double probability) { return unit() < probability; }
+
+        /// Standard normal via Box-Muller (result depends on libm's log and cos)
+        double normal()
+        {
+            double u1 = std::max(unit(), 1e-300);
+            double u2 = unit();
+            return std::sqrt(-2.0 * std::log(u1)) * std::cos(6.283185307179586 * u2);
+        }
+
+        uint64_t next() { return engine_(); }
+
+    private:
+        std::mt19937_64 engine_;
+    };
+
+    inline size_t drawLineLength(Random& random, const FileSpec& spec)
+    {
+        double length = spec.meanLength;
+        switch (spec.distribution)
+        {
+        case LengthDistribution::Fixed:
+            break;
+        case LengthDistribution::Uniform:
+            return random.between(spec.minLength, spec.maxLength);
+        case LengthDistribution::Normal:
+            length = spec.meanLength + spec.standardDeviation * random.normal();
+            break;
+        case LengthDistribution::LogNormal:
+        {
+            double shape = spec.meanLength > 0 ? spec.standardDeviation / spec.meanLength : 0;
+            length = spec.meanLength * std::exp(shape * random.normal());
+            break;
+        }
+        }
+        double clamped = std::clamp(length, static_cast<double>(spec.minLength), static_cast<double>(spec.maxLength));
+        return static_cast<size_t>(std::lround(clamped));
+    }
+
+    /**
+     * @brief Appends a line body of exactly `length` bytes, never splitting a UTF-8 sequence
+     */
+    inline void appendLineBody(std::string& line, size_t length, Random& random, double utf8Ratio)
+    {
+        static const char* const asciiWords[] = {
+            "alpha", "request", "user", "id", "status", "ok", "error", "config", "value", "path",
+            "timeout", "GET", "POST", "200", "404", "file", "cache", "index", "node", "queue"
+        };
+        static const char* const utf8Words[] = {
+            "café", "naïve", "Grüße", "façade", "日本語", "данные", "προϊόν", "한국어", "emoji😀", "ñandú"
+        };
+
+        const size_t end = line.size() + length;
+        while (line.size() < end)
+        {
+            if (!line.empty() && line.back() != ' ' && line.size() + 1 < end)
+                line += ' ';
+
+            const char* word = random.chance(utf8Ratio) ? utf8Words[random.between(0, 9)]
+                                                        : asciiWords[random.between(0, 19)];
+            size_t wordLength = std::char_traits<char>::length(word);
+            if (line.size() + wordLength > end)
+                break;
+            line += word;
+        }
+        line.append(end - std::min(end, line.size()), 'x');
+    }
+
+    /**
+     * @brief Writes one line file described by spec
+     */
+    inline GeneratedStats generateFile(const std::string& path, const FileSpec& spec)
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out.is_open())
+            throw std::runtime_error("Failed to create dataset file: " + path);
+
+        Random random(spec.seed);
+        GeneratedStats stats;
+        stats.files = 1;
+        std::string line;
+        const char* ending = spec.crlf ? "\r\n" : "\n";
+
+        for (size_t index = 0; index < spec.lineCount; ++index)
+        {
+            line.clear();
+            if (random.chance(spec.emptyLineRatio))
+            {
+                ++stats.emptyLines;
+            }
+            else
+            {
+                size_t length = drawLineLength(random, spec);
+                if (random.chance(spec.commentRatio))
+                {
+                    line = spec.commentPrefix;
+                    ++stats.commentLines;
+                }
+                appendLineBody(line, length - std::min(length, line.size()), random, spec.utf8Ratio);
+            }
+
+            line += ending;
+            out.write(line.data(), static_cast<std::streamsize>(line.size()));
+            stats.bytes += line.size();
+            ++stats.lines;
+        }
+
+        if (!out)
+            throw std::runtime_error("Failed to write dataset file: " + path);
+        return stats;
+    }
+
+    /**
+     * @brief Creates a directory tree under root filled with generated files
+     *
+     * @return GeneratedStats Totals across every file; `directories` includes root
+     */
+    inline GeneratedStats generateDirectoryTree(const std::string& root, const DirectorySpec& spec)
+    {
+        std::vector<fs::path> directories = {fs::path(root)};
+        std::vector<fs::path> level = directories;
+        for (size_t depth = 0; depth < spec.depth; ++depth)
+        {
+            std::vector<fs::path> nextLevel;
+            for (const fs::path& parent : level)
+            {
+                for (size_t child = 0; child < spec.fanout; ++child)
+                    nextLevel.push_back(parent / ("dir_" + std::to_string(child)));
+            }
+            directories.insert(directories.end(), nextLevel.begin(), nextLevel.end());
+            level = std::move(nextLevel);
+        }
+
+        for (const fs::path& directory : directories)
+            fs::create_directories(directory);
+
+        Random random(spec.seed);
+        GeneratedStats total;
+        total.directories = directories.size();
+
+        for (size_t index = 0; index < spec.fileCount; ++index)
+        {
+            std::string extension = spec.extensions.empty()
+                ? std::string()
+                : spec.extensions[random.between(0, spec.extensions.size() - 1)];
+            fs::path path = directories[index % directories.size()] / ("file_" + std::to_string(index) + extension);
+
+            FileSpec fileSpec = spec.file;
+            fileSpec.seed = random.next();
+            GeneratedStats stats = generateFile(path.string(), fileSpec);
+
+            total.files += stats.files;
+            total.lines += stats.lines;
+            total.commentLines += stats.commentLines;
+            total.emptyLines += stats.emptyLines;
+            total.bytes += stats.bytes;
+        }
+
+        return total;
+    }
+}
+
+#endif // STEVENS_FILE_LIB_DATASET_GENERATOR_HPP
@@ -0,0 +1,161 @@
+#include "dataset_generator.hpp"
+#include <iostream>
+#include <string>
+#include <unordered_map>
+
+// ============================================================================
+// stevensFileLib_dataset_generator
+//
+//   stevensFileLib_dataset_generator file <path> [--key=value ...]
+//   stevensFileLib_dataset_generator tree <directory> [--key=value ...]
+//
+// File options: seed, lines, distribution (fixed|uniform|normal|lognormal), mean,
+// stddev, min, max, utf8, comments, empty, comment-prefix, crlf (0|1).
+// Tree options: all file options (applied to each file) plus files, depth, fanout,
+// extensions (comma-separated).
+// ============================================================================
+
+namespace
+{
+    using Options = std::unordered_map<std::string, std::string>;
+
+    void printUsage()
+    {
+        std::cerr << "usage: stevensFileLib_dataset_generator file <path> [--key=value ...]\n"
+                  << "       stevensFileLib_dataset_generator tree <directory> [--key=value ...]\n"
+                  << "file options: --seed --lines --distribution=fixed|uniform|normal|lognormal --mean --stddev\n"
+                  << "              --min --max --utf8 --comments --empty --comment-prefix --crlf=0|1\n"
+                  << "tree options: --files --depth --fanout --extensions=.txt,.log plus the file options\n";
+    }
+
+    Options parseOptions(int argc, char** argv, int first)
+    {
+        Options options;
+        for (int i = first; i < argc; ++i)
+        {
+            std::string argument = argv[i];
+            size_t equals = argument.find('=');
+            if (argument.rfind("--", 0) != 0 || equals == std::string::npos)
+                throw std::invalid_argument("Expected --key=value, got: " + argument);
+            options[argument.substr(2, equals - 2)] = argument.substr(equals + 1);
+        }
+        return options;
+    }
+
+    /**
+     * @brief Removes and returns an option, or the fallback when it was not given
+     */
+    std::string take(Options& options, const std::string& key, const std::string& fallback)
+    {
+        auto found = options.find(key);
+        if (found == options.end())
+            return fallback;
+        std::string value = found->second;
+        options.erase(found);
+        return value;
+    }
+
+    datasetGenerator::LengthDistribution parseDistribution(const std::string& name)
+    {
+        if (name == "fixed")
+            return datasetGenerator::LengthDistribution::Fixed;
+        if (name == "uniform")
+            return datasetGenerator::LengthDistribution::Uniform;
+        if (name == "normal")
+            return datasetGenerator::LengthDistribution::Normal;
+        if (name == "lognormal")
+            return datasetGenerator::LengthDistribution::LogNormal;
+        throw std::invalid_argument("Unknown distribution: " + name);
+    }
+
+    datasetGenerator::FileSpec takeFileSpec(Options& options, datasetGenerator::FileSpec spec)
+    {
+        spec.seed = std::stoull(take(options, "seed", std::to_string(spec.seed)));
+        spec.lineCount = std::stoull(take(options, "lines", std::to_string(spec.lineCount)));
+        spec.distribution = parseDistribution(take(options, "distribution", "lognormal"));
+        spec.meanLength = std::stod(take(options, "mean", std::to_string(spec.meanLength)));
+        spec.standardDeviation = std::stod(take(options, "stddev", std::to_string(spec.standardDeviation)));
+        spec.minLength = std::stoull(take(options, "min", std::to_string(spec.minLength)));
+        spec.maxLength = std::stoull(take(options, "max", std::to_string(spec.maxLength)));
+        spec.utf8Ratio = std::stod(take(options, "utf8", std::to_string(spec.utf8Ratio)));
+        spec.commentRatio = std::stod(take(options, "comments", std::to_string(spec.commentRatio)));
+        spec.emptyLineRatio = std::stod(take(options, "empty", std::to_string(spec.emptyLineRatio)));
+        spec.commentPrefix = take(options, "comment-prefix", spec.commentPrefix);
+        spec.crlf = take(options, "crlf", "0") == "1";
+        return spec;
+    }
+
+    std::vector<std::string> splitList(const std::string& text)
+    {
+        std::vector<std::string> items;
+        size_t start = 0;
+        while (start <= text.size())
+        {
+            size_t comma = std::min(text.find(',', start), text.size());
+            if (comma > start)
+                items.push_back(text.substr(start, comma - start));
+            start = comma + 1;
+        }
+        return items;
+    }
+
+    void printStats(const datasetGenerator::GeneratedStats& stats)
+    {
+        std::cout << "files=" << stats.files << " directories=" << stats.directories << " lines=" << stats.lines
+                  << " comment_lines=" << stats.commentLines << " empty_lines=" << stats.emptyLines
+                  << " bytes=" << stats.bytes << "\n";
+    }
+
+    void rejectUnknown(const Options& options)
+    {
+        if (!options.empty())
+            throw std::invalid_argument("Unknown option: --" + options.begin()->first);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        printUsage();
+        return 2;
+    }
+
+    try
+    {
+        const std::string mode = argv[1];
+        const std::string target = argv[2];
+        Options options = parseOptions(argc, argv, 3);
+
+        if (mode == "file")
+        {
+            datasetGenerator::FileSpec spec = takeFileSpec(options, {});
+            rejectUnknown(options);
+            printStats(datasetGenerator::generateFile(target, spec));
+            return 0;
+        }
+
+        if (mode == "tree")
+        {
+            datasetGenerator::DirectorySpec spec;
+            spec.fileCount = std::stoull(take(options, "files", std::to_string(spec.fileCount)));
+            spec.depth = std::stoull(take(options, "depth", std::to_string(spec.depth)));
+            spec.fanout = std::stoull(take(options, "fanout", std::to_string(spec.fanout)));
+            if (options.count("extensions"))
+                spec.extensions = splitList(take(options, "extensions", ""));
+            spec.file = takeFileSpec(options, spec.file);
+            spec.seed = spec.file.seed;
+            rejectUnknown(options);
+            printStats(datasetGenerator::generateDirectoryTree(target, spec));
+            return 0;
+        }
+
+        printUsage();
+        return 2;
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << "error: " << error.what() << "\n";
+        return 1;
+    }
+}
@@ -22,9 +22,65 @@
 #include <random>
 #include <algorithm>
 #include <sstream>
+#include <string_view>
+#include <cstring>
+#include <cerrno>
+#include <charconv>
+#include <memory>
+#include <new>
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <chrono>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include <deque>
+#include <limits>
+#include <future>
+#include <cstdio>
+#include <optional>
+
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+    #if __has_include(<coroutine>)
+        #define STEVENS_FILE_LIB_COROUTINES 1
+        #include <coroutine>
+    #endif
+#endif
+#ifndef STEVENS_FILE_LIB_COROUTINES
+    #define STEVENS_FILE_LIB_COROUTINES 0
+#endif
+
+// Define as 1 (consistently, in every translation unit) to record per-operation metrics
+#ifndef STEVENS_FILE_LIB_INSTRUMENTATION
+    #define STEVENS_FILE_LIB_INSTRUMENTATION 0
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define STEVENS_FILE_LIB_POSIX 1
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/stat.h>
+    #include <sys/uio.h>
+    #include <sys/mman.h>
+    #include <climits>
+#else
+    #define STEVENS_FILE_LIB_POSIX 0
+#endif
 
 namespace stevensFileLib
 {
+    namespace internal
+    {
+        class DelimitedParser;
+    }
+
     // ============================================================================
     // Configuration Structures
     // ============================================================================
@@ -102,275 +158,4909 @@ namespace stevensFileLib
         }
     };
 
-    // ============================================================================
-    // Internal String Utilities (to remove external dependency)
-    // ============================================================================
+    /**
+     * @brief Kernel access-pattern hint issued when a file is opened for reading
+     */
+    enum class ReadAccessPattern
+    {
+        Normal,       ///< No hint; use the kernel's default readahead
+        Sequential,   ///< POSIX_FADV_SEQUENTIAL / MADV_SEQUENTIAL: aggressive readahead
+        NoReuse       ///< POSIX_FADV_NOREUSE: data will be read once
+    };
 
-    namespace internal
+    /**
+     * @brief I/O configuration shared by all file readers
+     *
+     * Hints that the platform does not support are silently ignored.
+     */
+    struct ReadOptions
     {
-        inline bool startsWith(const std::string& str, const std::string& prefix)
+        size_t bufferSize = 1 << 20;
+        ReadAccessPattern accessPattern = ReadAccessPattern::Sequential;
+        bool directIo = false;      ///< Bypass the page cache with O_DIRECT where supported
+        bool memoryMap = false;     ///< Map the whole file instead of reading it in chunks
+        bool hugePages = false;     ///< Request MADV_HUGEPAGE for memory-mapped files
+        bool dropCache = false;     ///< Evict consumed pages (POSIX_FADV_DONTNEED) as the file is read
+
+        /**
+         * @brief Options for one-shot scans that should not pollute the page cache
+         */
+        static ReadOptions streaming()
         {
-            if (prefix.size() > str.size())
-                return false;
-            return str.compare(0, prefix.size(), prefix) == 0;
+            ReadOptions options;
+            options.accessPattern = ReadAccessPattern::Sequential;
+            options.dropCache = true;
+            return options;
         }
+    };
+
+    /**
+     * @brief Configuration for loading delimited (CSV/TSV) records
+     */
+    struct DelimitedSettings
+    {
+        char fieldSeparator = ',';
+        char recordSeparator = '\n';
+        char quote = '"';
+        bool quoting = true;
+        bool hasHeader = false;
+        bool skipEmptyLines = true;
+        std::vector<std::string> skipIfStartsWith;
 
-        inline bool contains(const std::string& str, const std::string& substring)
+        static DelimitedSettings csv()
         {
-            return str.find(substring) != std::string::npos;
+            return DelimitedSettings();
         }
 
-        inline std::vector<std::string> splitString(const std::string& str, const std::string& delimiter)
+        static DelimitedSettings tsv()
         {
-            std::vector<std::string> result;
-            size_t start = 0;
-            size_t end = str.find(delimiter);
+            DelimitedSettings settings;
+            settings.fieldSeparator = '\t';
+            settings.quoting = false;
+            return settings;
+        }
+    };
 
-            while (end != std::string::npos)
-            {
-                result.push_back(str.substr(start, end - start));
-                start = end + delimiter.length();
-                end = str.find(delimiter, start);
-            }
+    /**
+     * @brief Durability guarantee applied before an atomic write is published
+     */
+    enum class FsyncPolicy
+    {
+        None,   ///< Leave flushing to the operating system
+        Data,   ///< Flush file data (fdatasync) before the rename
+        Full    ///< Flush file data and metadata, then the parent directory
+    };
 
-            result.push_back(str.substr(start));
-            return result;
-        }
-    }
+    /**
+     * @brief How a writer treats an existing file
+     */
+    enum class WriteMode
+    {
+        Truncate,   ///< Replace any existing contents
+        Append      ///< Add to the end of any existing contents
+    };
+
+    /**
+     * @brief Configuration for atomic whole-file writes
+     */
+    struct AtomicWriteSettings
+    {
+        FsyncPolicy fsyncPolicy = FsyncPolicy::None;
+        size_t bufferSize = 1 << 20;
+    };
 
     // ============================================================================
-    // File Opening Functions
+    // Instrumentation (opt-in)
     // ============================================================================
 
     /**
-     * @brief Opens a file for reading with validation
+     * @brief True when the library was compiled with STEVENS_FILE_LIB_INSTRUMENTATION=1
      *
-     * @param filePath Path to the file
-     * @return std::ifstream Input file stream object
-     * @throws std::invalid_argument if file cannot be opened
+     * When false, every recording hook is an empty inline function and instrumentationSnapshot()
+     * returns no operations.
      */
-    inline std::ifstream openInputFile(const std::string& filePath)
-    {
-        std::ifstream file(filePath);
-        if (!file.is_open())
-            throw std::invalid_argument("Failed to open file for reading: " + filePath);
-        return file;
-    }
+    constexpr bool instrumentationEnabled = STEVENS_FILE_LIB_INSTRUMENTATION != 0;
 
     /**
-     * @brief Opens a file for appending with validation
-     *
-     * @param filePath Path to the file
-     * @return std::ofstream Output file stream object
-     * @throws std::invalid_argument if file cannot be opened
+     * @brief Library operations tracked by the instrumentation layer
      */
-    inline std::ofstream openOutputFile(const std::string& filePath)
+    enum class Operation
     {
-        std::ofstream file(filePath, std::ios::app);
-        if (!file.is_open())
-            throw std::invalid_argument("Failed to open file for writing: " + filePath);
-        return file;
+        LoadFileIntoVector,
+        LoadFileIntoVectorOfInts,
+        GetRandomFileLine,
+        LoadDelimitedFile,
+        LoadFileIntoSet,
+        LoadFileIntoMap,
+        AppendToFile,
+        WriteFileAtomic,
+        WriteLinesToFile,
+        ListFiles,
+        LoadDirectory,
+        Count
+    };
+
+    inline const char* operationName(Operation operation)
+    {
+        static const char* const names[] = {
+            "loadFileIntoVector", "loadFileIntoVectorOfInts", "getRandomFileLine", "loadDelimitedFile",
+            "loadFileIntoSet", "loadFileIntoMap", "appendToFile", "writeFileAtomic", "writeLinesToFile",
+            "listFiles", "loadDirectory"
+        };
+        static_assert(sizeof(names) / sizeof(names[0]) == static_cast<size_t>(Operation::Count),
+                      "every Operation needs a name");
+        return names[static_cast<size_t>(operation)];
     }
 
-    // ============================================================================
-    // File Writing Functions
-    // ============================================================================
+    /**
+     * @brief One non-empty latency histogram bucket: calls that took at most upperBoundNanoseconds
+     */
+    struct LatencyBucket
+    {
+        uint64_t upperBoundNanoseconds = 0;
+        uint64_t count = 0;
+    };
 
     /**
-     * @brief Appends content to a file, optionally creating it if it doesn't exist
+     * @brief Totals recorded for one operation since start-up or the last resetInstrumentation()
      *
-     * @tparam ContentType Type of content to append (must support operator<<)
-     * @param filePath Path to the file
-     * @param content Content to append
-     * @param createIfNonExistent If true, creates the file if it doesn't exist
-     * @throws std::invalid_argument if file doesn't exist and createIfNonExistent is false
-     * @throws std::runtime_error if file creation fails
+     * Bytes and syscalls (read, write, writev, mmap) cover the calling thread plus any work the
+     * operation hands to an Executor. `lines` counts lines read or written; listFiles leaves it at 0.
      */
-    template<typename ContentType>
-    void appendToFile(const std::string& filePath, const ContentType& content,
-                     bool createIfNonExistent = true)
+    struct OperationMetrics
     {
-        // Check if file exists when createIfNonExistent is false
-        if (!createIfNonExistent && !std::filesystem::exists(filePath))
-            throw std::invalid_argument("File does not exist: " + filePath);
+        Operation operation = Operation::Count;
+        uint64_t calls = 0;
+        uint64_t errors = 0;            ///< Calls that exited by throwing
+        uint64_t bytesRead = 0;
+        uint64_t bytesWritten = 0;
+        uint64_t lines = 0;
+        uint64_t syscalls = 0;
+        uint64_t totalNanoseconds = 0;
+        std::vector<LatencyBucket> latency;  ///< Ascending; bucket bounds are within ~6% of true values
 
-        std::ofstream file(filePath, std::ios::app);
-        if (!file.is_open())
-            throw std::runtime_error("Failed to open file for writing: " + filePath);
+        /**
+         * @brief Smallest bucket bound that covers the given fraction of calls
+         * @param quantile Fraction in [0, 1], e.g. 0.99
+         * @return Latency in nanoseconds; 0 when no calls were recorded
+         */
+        uint64_t quantileNanoseconds(double quantile) const
+        {
+            uint64_t total = 0;
+            for (const LatencyBucket& bucket : latency)
+                total += bucket.count;
 
-        file << content;
-    }
+            const double target = quantile * static_cast<double>(total);
+            uint64_t seen = 0;
+            for (const LatencyBucket& bucket : latency)
+            {
+                seen += bucket.count;
+                if (static_cast<double>(seen) >= target)
+                    return bucket.upperBoundNanoseconds;
+            }
+            return 0;
+        }
+    };
 
-    // ============================================================================
-    // Line Filtering Helper Functions
-    // ============================================================================
+    /**
+     * @brief Point-in-time copy of all instrumentation counters
+     */
+    struct InstrumentationSnapshot
+    {
+        std::vector<OperationMetrics> operations;  ///< Operations called at least once, in enum order
+
+        const OperationMetrics* find(Operation operation) const
+        {
+            for (const OperationMetrics& metrics : operations)
+            {
+                if (metrics.operation == operation)
+                    return &metrics;
+            }
+            return nullptr;
+        }
+    };
 
     namespace internal
     {
-        inline bool shouldSkipLine(const std::string& line, const LoadSettings& settings)
+        /**
+         * @brief I/O totals attributed to the operation running on a thread
+         */
+        struct IoAccumulator
         {
-            if (settings.skipEmptyLines && line.empty())
-                return true;
+            std::atomic<uint64_t> bytesRead{0};
+            std::atomic<uint64_t> bytesWritten{0};
+            std::atomic<uint64_t> syscalls{0};
+        };
 
-            for (const auto& prefix : settings.skipIfStartsWith)
+#if STEVENS_FILE_LIB_INSTRUMENTATION
+        /**
+         * @brief HDR-style log-linear histogram: 16 linear sub-buckets per power of two
+         */
+        class LatencyHistogram
+        {
+        public:
+            static constexpr unsigned subBucketBits = 4;
+            static constexpr uint64_t subBucketCount = uint64_t(1) << subBucketBits;
+            static constexpr size_t bucketCount = (64 - subBucketBits + 1) * subBucketCount;
+
+            void record(uint64_t nanoseconds)
             {
-                if (startsWith(line, prefix))
-                    return true;
+                counts_[bucketIndex(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
             }
 
-            for (const auto& substring : settings.skipIfContains)
+            void reset()
             {
-                if (contains(line, substring))
-                    return true;
+                for (auto& count : counts_)
+                    count.store(0, std::memory_order_relaxed);
             }
 
-            return false;
-        }
+            std::vector<LatencyBucket> buckets() const
+            {
+                std::vector<LatencyBucket> result;
+                for (size_t index = 0; index < bucketCount; ++index)
+                {
+                    uint64_t count = counts_[index].load(std::memory_order_relaxed);
+                    if (count != 0)
+                        result.push_back({upperBound(index), count});
+                }
+                return result;
+            }
 
-        inline bool shouldIncludeFile(const std::filesystem::path& filePath,
-                                     const ListFilesSettings& settings)
+        private:
+            static unsigned highestBit(uint64_t value)
+            {
+#if defined(__GNUC__) || defined(__clang__)
+                return 63u - static_cast<unsigned>(__builtin_clzll(value));
+#else
+                unsigned bit = 0;
+                while (value >>= 1)
+                    ++bit;
+                return bit;
+#endif
+            }
+
+            static size_t bucketIndex(uint64_t value)
+            {
+                if (value < subBucketCount)
+                    return static_cast<size_t>(value);
+
+                unsigned magnitude = highestBit(value) - subBucketBits + 1;
+                uint64_t subBucket = (value >> (magnitude - 1)) - subBucketCount;
+                return static_cast<size_t>(magnitude * subBucketCount + subBucket);
+            }
+
+            static uint64_t upperBound(size_t index)
+            {
+                uint64_t magnitude = index / subBucketCount;
+                uint64_t subBucket = index % subBucketCount;
+                if (magnitude == 0)
+                    return subBucket;
+
+                uint64_t width = uint64_t(1) << (magnitude - 1);
+                return (subBucketCount + subBucket) * width + (width - 1);
+            }
+
+            std::atomic<uint64_t> counts_[bucketCount] = {};
+        };
+
+        struct OperationCounters
         {
-            const std::string filename = filePath.filename().string();
-            const std::string extension = filePath.extension().string();
+            std::atomic<uint64_t> calls{0};
+            std::atomic<uint64_t> errors{0};
+            std::atomic<uint64_t> lines{0};
+            std::atomic<uint64_t> totalNanoseconds{0};
+            IoAccumulator io;
+            LatencyHistogram latency;
+        };
 
-            if (settings.excludeFiles.count(filename) > 0)
-                return false;
+        inline OperationCounters& operationCounters(Operation operation)
+        {
+            static OperationCounters counters[static_cast<size_t>(Operation::Count)];
+            return counters[static_cast<size_t>(operation)];
+        }
 
-            if (!settings.targetExtensions.empty())
-                return settings.targetExtensions.count(extension) > 0;
+        inline IoAccumulator*& activeIo()
+        {
+            static thread_local IoAccumulator* active = nullptr;
+            return active;
+        }
 
-            if (!settings.excludeExtensions.empty())
-                return settings.excludeExtensions.count(extension) == 0;
+        inline void addIo(IoAccumulator& target, uint64_t bytesRead, uint64_t bytesWritten, uint64_t syscalls)
+        {
+            target.bytesRead.fetch_add(bytesRead, std::memory_order_relaxed);
+            target.bytesWritten.fetch_add(bytesWritten, std::memory_order_relaxed);
+            target.syscalls.fetch_add(syscalls, std::memory_order_relaxed);
+        }
 
-            return true;
+        /**
+         * @brief Records bytes read by the given number of syscalls against the active operation
+         */
+        inline void noteRead(size_t bytes, uint64_t syscalls = 1)
+        {
+            if (IoAccumulator* io = activeIo())
+                addIo(*io, bytes, 0, syscalls);
         }
-    }
 
-    // ============================================================================
-    // File Reading Functions
-    // ============================================================================
+        inline void noteWrite(size_t bytes, uint64_t syscalls = 1)
+        {
+            if (IoAccumulator* io = activeIo())
+                addIo(*io, 0, bytes, syscalls);
+        }
+
+        /**
+         * @brief Times one public call and records it on destruction
+         *
+         * While alive, I/O on this thread is attributed to the operation. Nested operations
+         * record themselves and also pass their I/O up to the enclosing one.
+         */
+        class ScopedOperation
+        {
+        public:
+            explicit ScopedOperation(Operation operation)
+                : operation_(operation), previous_(activeIo()), uncaught_(std::uncaught_exceptions()),
+                  start_(std::chrono::steady_clock::now())
+            {
+                activeIo() = &io_;
+            }
+
+            ~ScopedOperation()
+            {
+                auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start_).count();
+                activeIo() = previous_;
+
+                uint64_t bytesRead = io_.bytesRead.load(std::memory_order_relaxed);
+                uint64_t bytesWritten = io_.bytesWritten.load(std::memory_order_relaxed);
+                uint64_t syscalls = io_.syscalls.load(std::memory_order_relaxed);
+                if (previous_)
+                    addIo(*previous_, bytesRead, bytesWritten, syscalls);
+
+                OperationCounters& counters = operationCounters(operation_);
+                counters.calls.fetch_add(1, std::memory_order_relaxed);
+                if (std::uncaught_exceptions() > uncaught_)
+                    counters.errors.fetch_add(1, std::memory_order_relaxed);
+                counters.lines.fetch_add(lines_, std::memory_order_relaxed);
+                counters.totalNanoseconds.fetch_add(static_cast<uint64_t>(elapsed), std::memory_order_relaxed);
+                addIo(counters.io, bytesRead, bytesWritten, syscalls);
+                counters.latency.record(static_cast<uint64_t>(elapsed));
+            }
+
+            ScopedOperation(const ScopedOperation&) = delete;
+            ScopedOperation& operator=(const ScopedOperation&) = delete;
+
+            void addLines(size_t lines) { lines_ += lines; }
+
+            /// Accumulator for work this operation runs on other threads (see IoAttribution)
+            IoAccumulator* io() { return &io_; }
+
+        private:
+            Operation operation_;
+            IoAccumulator io_;
+            IoAccumulator* previous_;
+            int uncaught_;
+            std::chrono::steady_clock::time_point start_;
+            uint64_t lines_ = 0;
+        };
+
+        /**
+         * @brief Attributes I/O on a worker thread to an operation started on another thread
+         */
+        class IoAttribution
+        {
+        public:
+            explicit IoAttribution(IoAccumulator* target) : previous_(activeIo()) { activeIo() = target; }
+            ~IoAttribution() { activeIo() = previous_; }
+
+            IoAttribution(const IoAttribution&) = delete;
+            IoAttribution& operator=(const IoAttribution&) = delete;
+
+        private:
+            IoAccumulator* previous_;
+        };
+#else
+        inline void noteRead(size_t, uint64_t = 1) {}
+        inline void noteWrite(size_t, uint64_t = 1) {}
+
+        class ScopedOperation
+        {
+        public:
+            explicit ScopedOperation(Operation) {}
+            void addLines(size_t) {}
+            IoAccumulator* io() { return nullptr; }
+        };
+
+        class IoAttribution
+        {
+        public:
+            explicit IoAttribution(IoAccumulator*) {}
+        };
+#endif
+    }
 
     /**
-     * @brief Loads file contents line-by-line into a vector of strings
-     *
-     * @param filePath Path to the file
-     * @param settingsMap Settings for filtering lines (see LoadSettings)
-     * @param separator Character used to separate lines
-     * @param skipEmptyLines If true, skip empty lines
-     * @return std::vector<std::string> Vector containing file lines
-     * @throws std::invalid_argument if file cannot be opened
+     * @brief Copies the current instrumentation counters
+     * @return InstrumentationSnapshot Empty unless instrumentationEnabled
      */
-    inline std::vector<std::string> loadFileIntoVector(
-        const std::string& filePath,
-        const std::unordered_map<std::string, std::vector<std::string>>& settingsMap = {},
-        char separator = '\n',
-        bool skipEmptyLines = true)
+    inline InstrumentationSnapshot instrumentationSnapshot()
     {
-        std::ifstream file = openInputFile(filePath);
-        LoadSettings settings(settingsMap, separator, skipEmptyLines);
-
-        std::vector<std::string> lines;
-        std::string line;
-
-        while (std::getline(file, line, separator))
+        InstrumentationSnapshot snapshot;
+#if STEVENS_FILE_LIB_INSTRUMENTATION
+        for (size_t index = 0; index < static_cast<size_t>(Operation::Count); ++index)
         {
-            if (!internal::shouldSkipLine(line, settings))
-                lines.push_back(line);
-        }
+            const Operation operation = static_cast<Operation>(index);
+            const internal::OperationCounters& counters = internal::operationCounters(operation);
+            if (counters.calls.load(std::memory_order_relaxed) == 0)
+                continue;
 
-        return lines;
+            OperationMetrics metrics;
+            metrics.operation = operation;
+            metrics.calls = counters.calls.load(std::memory_order_relaxed);
+            metrics.errors = counters.errors.load(std::memory_order_relaxed);
+            metrics.bytesRead = counters.io.bytesRead.load(std::memory_order_relaxed);
+            metrics.bytesWritten = counters.io.bytesWritten.load(std::memory_order_relaxed);
+            metrics.lines = counters.lines.load(std::memory_order_relaxed);
+            metrics.syscalls = counters.io.syscalls.load(std::memory_order_relaxed);
+            metrics.totalNanoseconds = counters.totalNanoseconds.load(std::memory_order_relaxed);
+            metrics.latency = counters.latency.buckets();
+            snapshot.operations.push_back(std::move(metrics));
+        }
+#endif
+        return snapshot;
     }
 
     /**
-     * @brief Loads file contents into a vector of integers
-     *
-     * @param filePath Path to the file
-     * @param settingsMap Settings for filtering lines (currently unused but kept for API compatibility)
-     * @param separator Character used to separate values
-     * @param skipEmptyLines If true, skip empty lines
-     * @return std::vector<int> Vector containing integer values
-     * @throws std::invalid_argument if file cannot be opened
+     * @brief Zeroes all instrumentation counters
      */
-    inline std::vector<int> loadFileIntoVectorOfInts(
-        const std::string& filePath,
-        [[maybe_unused]] const std::unordered_map<std::string, std::vector<std::string>>& settingsMap = {},
-        [[maybe_unused]] char separator = '\n',
-        [[maybe_unused]] bool skipEmptyLines = true)
+    inline void resetInstrumentation()
     {
-        std::ifstream file = openInputFile(filePath);
-        std::vector<int> numbers;
-        int value;
+#if STEVENS_FILE_LIB_INSTRUMENTATION
+        for (size_t index = 0; index < static_cast<size_t>(Operation::Count); ++index)
+        {
+            internal::OperationCounters& counters = internal::operationCounters(static_cast<Operation>(index));
+            counters.calls.store(0, std::memory_order_relaxed);
+            counters.errors.store(0, std::memory_order_relaxed);
+            counters.lines.store(0, std::memory_order_relaxed);
+            counters.totalNanoseconds.store(0, std::memory_order_relaxed);
+            counters.io.bytesRead.store(0, std::memory_order_relaxed);
+            counters.io.bytesWritten.store(0, std::memory_order_relaxed);
+            counters.io.syscalls.store(0, std::memory_order_relaxed);
+            counters.latency.reset();
+        }
+#endif
+    }
 
-        while (file >> value)
-            numbers.push_back(value);
+    namespace internal
+    {
+        inline void appendPrometheusCounter(std::ostringstream& out, const InstrumentationSnapshot& snapshot,
+                                            const char* name, const char* help,
+                                            uint64_t OperationMetrics::*field)
+        {
+            out << "# HELP stevens_file_lib_" << name << ' ' << help << "\n"
+                << "# TYPE stevens_file_lib_" << name << " counter\n";
+            for (const OperationMetrics& metrics : snapshot.operations)
+            {
+                out << "stevens_file_lib_" << name << "{operation=\"" << operationName(metrics.operation)
+                    << "\"} " << metrics.*field << "\n";
+            }
+        }
 
-        return numbers;
+        inline void appendPrometheusHistogram(std::ostringstream& out, const OperationMetrics& metrics)
+        {
+            static const uint64_t boundsNanoseconds[] = {
+                1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000, 10000000000
+            };
+            const char* name = operationName(metrics.operation);
+
+            size_t bucket = 0;
+            uint64_t cumulative = 0;
+            for (uint64_t bound : boundsNanoseconds)
+            {
+                for (; bucket < metrics.latency.size() && metrics.latency[bucket].upperBoundNanoseconds <= bound; ++bucket)
+                    cumulative += metrics.latency[bucket].count;
+                out << "stevens_file_lib_latency_seconds_bucket{operation=\"" << name << "\",le=\""
+                    << static_cast<double>(bound) / 1e9 << "\"} " << cumulative << "\n";
+            }
+            out << "stevens_file_lib_latency_seconds_bucket{operation=\"" << name << "\",le=\"+Inf\"} "
+                << metrics.calls << "\n"
+                << "stevens_file_lib_latency_seconds_sum{operation=\"" << name << "\"} "
+                << static_cast<double>(metrics.totalNanoseconds) / 1e9 << "\n"
+                << "stevens_file_lib_latency_seconds_count{operation=\"" << name << "\"} " << metrics.calls << "\n";
+        }
     }
 
     /**
-     * @brief Returns a random line from a file
+     * @brief Formats a snapshot in the Prometheus text exposition format
      *
-     * @param filePath Path to the file
-     * @param separator Character used to separate lines
-     * @return std::string A random line from the file
-     * @throws std::invalid_argument if file cannot be opened
-     * @throws std::runtime_error if file is empty
+     * Emits counters for calls, errors, bytes, lines and syscalls, and a latency histogram
+     * with decade buckets from 1 microsecond to 10 seconds, all labelled by operation.
+     *
+     * @param snapshot Counters to format, usually from instrumentationSnapshot()
+     * @return std::string Text ready to serve from a /metrics endpoint
      */
-    inline std::string getRandomFileLine(const std::string& filePath, char separator = '\n')
+    inline std::string formatPrometheus(const InstrumentationSnapshot& snapshot)
     {
-        std::vector<std::string> lines = loadFileIntoVector(filePath, {}, separator, false);
+        std::ostringstream out;
+        internal::appendPrometheusCounter(out, snapshot, "calls_total", "Completed library calls.",
+                                          &OperationMetrics::calls);
+        internal::appendPrometheusCounter(out, snapshot, "errors_total", "Library calls that threw.",
+                                          &OperationMetrics::errors);
+        internal::appendPrometheusCounter(out, snapshot, "read_bytes_total", "Bytes read from files.",
+                                          &OperationMetrics::bytesRead);
+        internal::appendPrometheusCounter(out, snapshot, "written_bytes_total", "Bytes written to files.",
+                                          &OperationMetrics::bytesWritten);
+        internal::appendPrometheusCounter(out, snapshot, "lines_total", "Lines read or written.",
+                                          &OperationMetrics::lines);
+        internal::appendPrometheusCounter(out, snapshot, "syscalls_total", "read, write, writev and mmap calls.",
+                                          &OperationMetrics::syscalls);
 
-        if (lines.empty())
-            throw std::runtime_error("Cannot get random line from empty file: " + filePath);
-
-        static std::random_device randomDevice;
-        static std::mt19937 generator(randomDevice());
-        std::uniform_int_distribution<size_t> distribution(0, lines.size() - 1);
+        out << "# HELP stevens_file_lib_latency_seconds Library call latency.\n"
+            << "# TYPE stevens_file_lib_latency_seconds histogram\n";
+        for (const OperationMetrics& metrics : snapshot.operations)
+            internal::appendPrometheusHistogram(out, metrics);
 
-        return lines[distribution(generator)];
+        return out.str();
     }
 
     // ============================================================================
-    // Directory Functions
+    // Tracing Hooks
     // ============================================================================
 
     /**
-     * @brief Lists all files in a directory with optional filtering
-     *
-     * @param directoryPath Path to the directory
-     * @param settingsMap Settings for filtering files (see ListFilesSettings)
-     * @return std::vector<std::string> Vector of filenames
-     * @throws std::invalid_argument if directory doesn't exist
+     * @brief Kind of file operation reported to a TraceSink
      */
-    inline std::vector<std::string> listFiles(
-        const std::string& directoryPath,
-        const std::unordered_map<std::string, std::string>& settingsMap = {
+    enum class TraceEventKind : uint8_t
+    {
+        Open,
+        Read,
+        Write,
+        Close
+    };
+
+    inline const char* traceEventName(TraceEventKind kind)
+    {
+        static const char* const names[] = {"open", "read", "write", "close"};
+        return names[static_cast<size_t>(kind)];
+    }
+
+    /**
+     * @brief One timed file operation
+     *
+     * `path` is only valid during TraceSink::record(). Timestamps come from steady_clock.
+     */
+    struct TraceEvent
+    {
+        TraceEventKind kind = TraceEventKind::Open;
+        std::string_view path;
+        uint64_t bytes = 0;                 ///< Bytes transferred; 0 for open and close
+        uint64_t startNanoseconds = 0;
+        uint64_t durationNanoseconds = 0;
+        uint32_t threadId = 0;              ///< Small per-process id, stable for a thread's lifetime
+    };
+
+    /**
+     * @brief Receives trace events from every thread that performs file I/O
+     *
+     * record() is called synchronously on the I/O thread, so it should be quick and must not throw.
+     */
+    class TraceSink
+    {
+    public:
+        virtual ~TraceSink() = default;
+        virtual void record(const TraceEvent& event) noexcept = 0;
+    };
+
+    namespace internal
+    {
+        /**
+         * @brief shared_ptr slot with atomic load and store, so readers never take a lock
+         */
+        template<typename T>
+        class AtomicSharedPtr
+        {
+        public:
+#if defined(__cpp_lib_atomic_shared_ptr)
+            std::shared_ptr<T> load() const { return pointer_.load(std::memory_order_acquire); }
+            void store(std::shared_ptr<T> value) { pointer_.store(std::move(value), std::memory_order_release); }
+
+        private:
+            std::atomic<std::shared_ptr<T>> pointer_;
+#else
+            std::shared_ptr<T> load() const { return std::atomic_load_explicit(&pointer_, std::memory_order_acquire); }
+            void store(std::shared_ptr<T> value) { std::atomic_store_explicit(&pointer_, std::move(value), std::memory_order_release); }
+
+        private:
+            std::shared_ptr<T> pointer_;
+#endif
+        };
+
+        struct TraceSinkSlot
+        {
+            std::atomic<bool> active{false};   ///< Checked first so untraced I/O never touches the shared_ptr
+            AtomicSharedPtr<TraceSink> sink;
+        };
+
+        inline TraceSinkSlot& traceSinkSlot()
+        {
+            static TraceSinkSlot slot;
+            return slot;
+        }
+
+        inline uint64_t steadyNanoseconds()
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        inline uint32_t currentTraceThreadId()
+        {
+            static std::atomic<uint32_t> nextId{1};
+            static thread_local uint32_t id = nextId.fetch_add(1, std::memory_order_relaxed);
+            return id;
+        }
+
+        /**
+         * @brief Times one file operation and reports it to the installed sink, if any
+         *
+         * With no sink installed this costs one relaxed atomic load on construction.
+         */
+        class TraceSpan
+        {
+        public:
+            TraceSpan(TraceEventKind kind, std::string_view path)
+                : kind_(kind), path_(path),
+                  start_(traceSinkSlot().active.load(std::memory_order_relaxed) ? steadyNanoseconds() : 0)
+            {
+            }
+
+            ~TraceSpan()
+            {
+                if (start_ == 0)
+                    return;
+
+                std::shared_ptr<TraceSink> sink = traceSinkSlot().sink.load();
+                if (!sink)
+                    return;
+
+                TraceEvent event;
+                event.kind = kind_;
+                event.path = path_;
+                event.bytes = bytes_;
+                event.startNanoseconds = start_;
+                event.durationNanoseconds = steadyNanoseconds() - start_;
+                event.threadId = currentTraceThreadId();
+                sink->record(event);
+            }
+
+            TraceSpan(const TraceSpan&) = delete;
+            TraceSpan& operator=(const TraceSpan&) = delete;
+
+            void setBytes(uint64_t bytes) { bytes_ = bytes; }
+
+            /// Emits nothing: for calls that failed or must be retried
+            void cancel() { start_ = 0; }
+
+        private:
+            TraceEventKind kind_;
+            std::string_view path_;
+            uint64_t start_;
+            uint64_t bytes_ = 0;
+        };
+    }
+
+    /**
+     * @brief Installs the sink that receives file I/O trace events; nullptr disables tracing
+     */
+    inline void setTraceSink(std::shared_ptr<TraceSink> sink)
+    {
+        auto& slot = internal::traceSinkSlot();
+        const bool active = sink != nullptr;
+        slot.sink.store(std::move(sink));
+        slot.active.store(active, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief The currently installed trace sink, or nullptr
+     */
+    inline std::shared_ptr<TraceSink> traceSink()
+    {
+        return internal::traceSinkSlot().sink.load();
+    }
+
+    namespace internal
+    {
+        inline void appendJsonString(std::string& out, std::string_view text)
+        {
+            static const char hexDigits[] = "0123456789abcdef";
+            out += '"';
+            for (char c : text)
+            {
+                unsigned char byte = static_cast<unsigned char>(c);
+                if (c == '"' || c == '\\')
+                {
+                    out += '\\';
+                    out += c;
+                }
+                else if (byte < 0x20)
+                {
+                    out += "\\u00";
+                    out += hexDigits[byte >> 4];
+                    out += hexDigits[byte & 0xf];
+                }
+                else
+                {
+                    out += c;
+                }
+            }
+            out += '"';
+        }
+    }
+
+    /**
+     * @brief Lock-free, fixed-size TraceSink that keeps the most recent events
+     *
+     * Writers claim a slot with one atomic increment and publish it with a sequence number,
+     * so record() never blocks and old events are overwritten once the buffer wraps. When a
+     * burst wraps the whole buffer while a slot is still being written, the later writer
+     * drops its event rather than mixing its words into the other one. Paths
+     * longer than maxPathLength keep their last maxPathLength bytes (the file name end).
+     * Readers (events(), toChromeTraceJson()) skip slots that are mid-write.
+     */
+    class RingBufferTraceSink : public TraceSink
+    {
+    public:
+        static constexpr size_t maxPathLength = 88;
+
+        /**
+         * @brief A copied event, safe to keep after record() returns
+         */
+        struct Entry
+        {
+            TraceEventKind kind = TraceEventKind::Open;
+            std::string path;
+            uint64_t bytes = 0;
+            uint64_t startNanoseconds = 0;
+            uint64_t durationNanoseconds = 0;
+            uint32_t threadId = 0;
+        };
+
+        /**
+         * @param capacity Number of events kept; rounded up to a power of two
+         */
+        explicit RingBufferTraceSink(size_t capacity = 1 << 16)
+            : mask_(roundUpToPowerOfTwo(std::max<size_t>(capacity, 2)) - 1), slots_(new Slot[mask_ + 1])
+        {
+        }
+
+        void record(const TraceEvent& event) noexcept override
+        {
+            const uint64_t index = next_.fetch_add(1, std::memory_order_relaxed);
+            Slot& slot = slots_[index & mask_];
+
+            // Writers whose indexes are capacity() apart share a slot: claim it only if no
+            // one is writing it and it does not already hold a newer event
+            uint64_t observed = slot.sequence.load(std::memory_order_relaxed);
+            if (observed % 2 != 0 || observed > 2 * index ||
+                !slot.sequence.compare_exchange_strong(observed, 2 * index + 1, std::memory_order_relaxed))
+                return;
+            std::atomic_thread_fence(std::memory_order_release);
+
+            std::string_view path = event.path;
+            if (path.size() > maxPathLength)
+                path.remove_prefix(path.size() - maxPathLength);
+
+            uint64_t pathWords[pathWordCount] = {};
+            if (!path.empty())
+                std::memcpy(pathWords, path.data(), path.size());
+
+            slot.words[0].store(static_cast<uint64_t>(event.kind) | (uint64_t(path.size()) << 8) |
+                                (uint64_t(event.threadId) << 32), std::memory_order_relaxed);
+            slot.words[1].store(event.bytes, std::memory_order_relaxed);
+            slot.words[2].store(event.startNanoseconds, std::memory_order_relaxed);
+            slot.words[3].store(event.durationNanoseconds, std::memory_order_relaxed);
+            for (size_t word = 0; word < pathWordCount; ++word)
+                slot.words[headerWordCount + word].store(pathWords[word], std::memory_order_relaxed);
+
+            slot.sequence.store(2 * index + 2, std::memory_order_release);
+        }
+
+        /**
+         * @brief Copies the buffered events, oldest first
+         */
+        std::vector<Entry> events() const
+        {
+            std::vector<std::pair<uint64_t, Entry>> ordered;
+            for (size_t index = 0; index <= mask_; ++index)
+            {
+                Entry entry;
+                uint64_t sequence = 0;
+                if (readSlot(slots_[index], entry, sequence))
+                    ordered.emplace_back(sequence, std::move(entry));
+            }
+
+            std::sort(ordered.begin(), ordered.end(),
+                      [](const auto& left, const auto& right) { return left.first < right.first; });
+
+            std::vector<Entry> result;
+            result.reserve(ordered.size());
+            for (auto& item : ordered)
+                result.push_back(std::move(item.second));
+            return result;
+        }
+
+        /**
+         * @brief Formats the buffered events as Chrome trace-event JSON
+         *
+         * Load the result in chrome://tracing or https://ui.perfetto.dev. Each event is a
+         * complete ("X") event on its thread's track, with path and bytes as arguments.
+         */
+        std::string toChromeTraceJson() const
+        {
+            std::string out = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+            bool first = true;
+            for (const Entry& entry : events())
+            {
+                if (!first)
+                    out += ',';
+                first = false;
+                appendChromeEvent(out, entry);
+            }
+            out += "]}\n";
+            return out;
+        }
+
+        size_t capacity() const { return mask_ + 1; }
+
+    private:
+        static constexpr size_t headerWordCount = 4;
+        static constexpr size_t pathWordCount = (maxPathLength + 7) / 8;
+
+        struct Slot
+        {
+            std::atomic<uint64_t> sequence{0};  ///< 0 empty, odd while writing, 2 * (index + 1) when published
+            std::atomic<uint64_t> words[headerWordCount + pathWordCount] = {};
+        };
+
+        static size_t roundUpToPowerOfTwo(size_t value)
+        {
+            size_t power = 1;
+            while (power < value)
+                power <<= 1;
+            return power;
+        }
+
+        static bool readSlot(const Slot& slot, Entry& entry, uint64_t& sequence)
+        {
+            sequence = slot.sequence.load(std::memory_order_acquire);
+            if (sequence == 0 || sequence % 2 != 0)
+                return false;
+
+            uint64_t words[headerWordCount + pathWordCount];
+            for (size_t word = 0; word < headerWordCount + pathWordCount; ++word)
+                words[word] = slot.words[word].load(std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) != sequence)
+                return false;
+
+            entry.kind = static_cast<TraceEventKind>(words[0] & 0xff);
+            entry.threadId = static_cast<uint32_t>(words[0] >> 32);
+            entry.bytes = words[1];
+            entry.startNanoseconds = words[2];
+            entry.durationNanoseconds = words[3];
+            size_t pathLength = std::min<size_t>((words[0] >> 8) & 0xff, maxPathLength);
+            entry.path.assign(reinterpret_cast<const char*>(words + headerWordCount), pathLength);
+            return true;
+        }
+
+        static void appendChromeEvent(std::string& out, const Entry& entry)
+        {
+            char timing[96];
+            std::snprintf(timing, sizeof(timing), "\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u",
+                          static_cast<double>(entry.startNanoseconds) / 1000.0,
+                          static_cast<double>(entry.durationNanoseconds) / 1000.0,
+                          static_cast<unsigned>(entry.threadId));
+
+            out += "{\"name\":\"";
+            out += traceEventName(entry.kind);
+            out += "\",\"cat\":\"io\",\"ph\":\"X\",";
+            out += timing;
+            out += ",\"args\":{\"path\":";
+            internal::appendJsonString(out, entry.path);
+            out += ",\"bytes\":";
+            out += std::to_string(entry.bytes);
+            out += "}}";
+        }
+
+        const size_t mask_;
+        std::unique_ptr<Slot[]> slots_;
+        std::atomic<uint64_t> next_{0};
+    };
+
+    // ============================================================================
+    // String Splitting Functions
+    // ============================================================================
+
+    /**
+     * @brief Lazy range of string_view tokens produced by splitView
+     *
+     * Tokens are found one at a time as the range is iterated, so iteration can stop
+     * early without scanning the rest of the text. The views point into the text
+     * passed to splitView, which must outlive the range. Iterators hold their own
+     * views of the text and delimiter, so they stay valid after the range is gone.
+     */
+    class SplitRange
+    {
+    public:
+        class iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const std::string_view*;
+            using reference = const std::string_view&;
+
+            iterator() = default;
+
+            reference operator*() const { return token_; }
+            pointer operator->() const { return &token_; }
+
+            iterator& operator++()
+            {
+                if (delimiterPosition_ == std::string_view::npos)
+                {
+                    start_ = std::string_view::npos;
+                    return *this;
+                }
+
+                start_ = delimiterPosition_ + delimiter_.size();
+                locateToken();
+                return *this;
+            }
+
+            iterator operator++(int)
+            {
+                iterator previous = *this;
+                ++*this;
+                return previous;
+            }
+
+            bool operator==(const iterator& other) const { return start_ == other.start_; }
+            bool operator!=(const iterator& other) const { return start_ != other.start_; }
+
+        private:
+            friend class SplitRange;
+
+            iterator(std::string_view text, std::string_view delimiter, size_t start)
+                : text_(text), delimiter_(delimiter), start_(start)
+            {
+                if (start_ != std::string_view::npos)
+                    locateToken();
+            }
+
+            void locateToken()
+            {
+                delimiterPosition_ = findDelimiter(text_, delimiter_, start_);
+                size_t tokenEnd = delimiterPosition_ == std::string_view::npos ? text_.size() : delimiterPosition_;
+                token_ = text_.substr(start_, tokenEnd - start_);
+            }
+
+            std::string_view text_;
+            std::string_view delimiter_;
+            size_t start_ = std::string_view::npos;
+            size_t delimiterPosition_ = std::string_view::npos;
+            std::string_view token_;
+        };
+
+        SplitRange(std::string_view text, std::string_view delimiter)
+            : text_(text), delimiter_(delimiter)
+        {
+        }
+
+        iterator begin() const { return iterator(text_, delimiter_, 0); }
+        iterator end() const { return iterator(); }
+
+    private:
+        static size_t findDelimiter(std::string_view text, std::string_view delimiter, size_t from)
+        {
+            if (delimiter.empty() || from >= text.size())
+                return std::string_view::npos;
+            if (delimiter.size() > 1)
+                return text.find(delimiter, from);
+
+            // Single-character delimiters use memchr, which libc vectorizes
+            const void* found = std::memchr(text.data() + from, delimiter[0], text.size() - from);
+            return found == nullptr ? std::string_view::npos
+                                    : static_cast<size_t>(static_cast<const char*>(found) - text.data());
+        }
+
+        std::string_view text_;
+        std::string_view delimiter_;
+    };
+
+    /**
+     * @brief Splits text on a delimiter lazily, without allocating
+     *
+     * Produces the same tokens as splitting eagerly: empty tokens between adjacent
+     * delimiters are kept and the text after the last delimiter is always a token.
+     * An empty delimiter yields the whole text as a single token.
+     *
+     * @param text Text to split; must outlive the returned range
+     * @param delimiter Delimiter between tokens
+     * @return SplitRange Forward range of std::string_view tokens
+     */
+    inline SplitRange splitView(std::string_view text, std::string_view delimiter)
+    {
+        return SplitRange(text, delimiter);
+    }
+
+    /**
+     * @brief Splits text into a caller-provided vector of views, reusing its capacity
+     *
+     * @param text Text to split; must outlive the views written to tokens
+     * @param delimiter Delimiter between tokens
+     * @param tokens Cleared, then filled with the tokens in order
+     */
+    inline void splitViewInto(std::string_view text, std::string_view delimiter,
+                              std::vector<std::string_view>& tokens)
+    {
+        tokens.clear();
+        for (std::string_view token : splitView(text, delimiter))
+            tokens.push_back(token);
+    }
+
+    // ============================================================================
+    // Internal String Utilities (to remove external dependency)
+    // ============================================================================
+
+    namespace internal
+    {
+        inline bool startsWith(std::string_view str, std::string_view prefix)
+        {
+            if (prefix.size() > str.size())
+                return false;
+            return str.compare(0, prefix.size(), prefix) == 0;
+        }
+
+        inline bool contains(std::string_view str, std::string_view substring)
+        {
+            return str.find(substring) != std::string_view::npos;
+        }
+
+        inline std::vector<std::string> splitString(const std::string& str, const std::string& delimiter)
+        {
+            std::vector<std::string> result;
+            for (std::string_view token : splitView(str, delimiter))
+                result.emplace_back(token);
+            return result;
+        }
+    }
+
+    // ============================================================================
+    // File Opening Functions
+    // ============================================================================
+
+    namespace internal
+    {
+        /**
+         * @brief Constructs a file stream inside an Open trace span
+         */
+        template<typename Stream>
+        inline Stream openStreamTraced(const std::string& filePath, std::ios::openmode mode)
+        {
+            TraceSpan span(TraceEventKind::Open, filePath);
+            return Stream(filePath, mode);
+        }
+    }
+
+    /**
+     * @brief Opens a file for reading with validation
+     *
+     * @param filePath Path to the file
+     * @return std::ifstream Input file stream object
+     * @throws std::invalid_argument if file cannot be opened
+     */
+    inline std::ifstream openInputFile(const std::string& filePath)
+    {
+        std::ifstream file = internal::openStreamTraced<std::ifstream>(filePath, std::ios::in);
+        if (!file.is_open())
+            throw std::invalid_argument("Failed to open file for reading: " + filePath);
+        return file;
+    }
+
+    /**
+     * @brief Opens a file for appending with validation
+     *
+     * @param filePath Path to the file
+     * @return std::ofstream Output file stream object
+     * @throws std::invalid_argument if file cannot be opened
+     */
+    inline std::ofstream openOutputFile(const std::string& filePath)
+    {
+        std::ofstream file = internal::openStreamTraced<std::ofstream>(filePath, std::ios::app);
+        if (!file.is_open())
+            throw std::invalid_argument("Failed to open file for writing: " + filePath);
+        return file;
+    }
+
+    // ============================================================================
+    // File Writing Functions
+    // ============================================================================
+
+    /**
+     * @brief Appends content to a file, optionally creating it if it doesn't exist
+     *
+     * @tparam ContentType Type of content to append (must support operator<<)
+     * @param filePath Path to the file
+     * @param content Content to append
+     * @param createIfNonExistent If true, creates the file if it doesn't exist
+     * @throws std::invalid_argument if file doesn't exist and createIfNonExistent is false
+     * @throws std::runtime_error if file creation fails
+     */
+    template<typename ContentType>
+    void appendToFile(const std::string& filePath, const ContentType& content,
+                     bool createIfNonExistent = true)
+    {
+        internal::ScopedOperation operation(Operation::AppendToFile);
+
+        // Check if file exists when createIfNonExistent is false
+        if (!createIfNonExistent && !std::filesystem::exists(filePath))
+            throw std::invalid_argument("File does not exist: " + filePath);
+
+        std::ofstream file = internal::openStreamTraced<std::ofstream>(filePath, std::ios::app);
+        if (!file.is_open())
+            throw std::runtime_error("Failed to open file for writing: " + filePath);
+
+        internal::TraceSpan writing(TraceEventKind::Write, filePath);
+        file << content;
+        file.flush();
+        if constexpr (std::is_convertible_v<const ContentType&, std::string_view>)
+        {
+            internal::noteWrite(std::string_view(content).size());
+            writing.setBytes(std::string_view(content).size());
+        }
+    }
+
+    // ============================================================================
+    // Atomic File Writing Functions
+    // ============================================================================
+
+    namespace internal
+    {
+        inline std::string makeTempPath(const std::string& targetPath)
+        {
+            static thread_local std::mt19937_64 generator(std::random_device{}());
+            std::ostringstream name;
+            name << targetPath << ".tmp." << std::hex << generator();
+            return name.str();
+        }
+
+#if STEVENS_FILE_LIB_POSIX
+        /**
+         * @brief Owns a POSIX file descriptor and closes it on destruction
+         */
+        class FileDescriptor
+        {
+        public:
+            explicit FileDescriptor(int fd = -1) : fd_(fd) {}
+            ~FileDescriptor() { reset(); }
+
+            FileDescriptor(const FileDescriptor&) = delete;
+            FileDescriptor& operator=(const FileDescriptor&) = delete;
+
+            FileDescriptor(FileDescriptor&& other) noexcept : fd_(other.release()) {}
+
+            FileDescriptor& operator=(FileDescriptor&& other) noexcept
+            {
+                if (this != &other)
+                    reset(other.release());
+                return *this;
+            }
+
+            int get() const { return fd_; }
+            explicit operator bool() const { return fd_ >= 0; }
+
+            int release()
+            {
+                int fd = fd_;
+                fd_ = -1;
+                return fd;
+            }
+
+            void reset(int fd = -1)
+            {
+                if (fd_ >= 0)
+                    ::close(fd_);
+                fd_ = fd;
+            }
+
+        private:
+            int fd_;
+        };
+
+        inline std::string describeErrno(const std::string& message, const std::string& filePath)
+        {
+            return message + ": " + filePath + " (" + std::strerror(errno) + ")";
+        }
+
+        inline void writeAll(int fd, const char* data, size_t size, const std::string& filePath)
+        {
+            while (size > 0)
+            {
+                TraceSpan span(TraceEventKind::Write, filePath);
+                ssize_t written = ::write(fd, data, size);
+                if (written < 0)
+                {
+                    // Only completed writes are traced; a retry gets its own span
+                    span.cancel();
+                    if (errno == EINTR)
+                        continue;
+                    throw std::runtime_error(describeErrno("Failed to write file", filePath));
+                }
+
+                noteWrite(static_cast<size_t>(written));
+                span.setBytes(static_cast<uint64_t>(written));
+                data += written;
+                size -= static_cast<size_t>(written);
+            }
+        }
+
+        inline void syncFileDescriptor(int fd, FsyncPolicy policy, const std::string& filePath)
+        {
+            if (policy == FsyncPolicy::None)
+                return;
+
+#if defined(__APPLE__)
+            int result = ::fsync(fd);
+#else
+            int result = policy == FsyncPolicy::Data ? ::fdatasync(fd) : ::fsync(fd);
+#endif
+            if (result != 0)
+                throw std::runtime_error(describeErrno("Failed to sync file", filePath));
+        }
+
+        inline void syncParentDirectory(const std::string& filePath)
+        {
+            std::string directory = std::filesystem::path(filePath).parent_path().string();
+            if (directory.empty())
+                directory = ".";
+
+            FileDescriptor dir(::open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+            if (!dir || ::fsync(dir.get()) != 0)
+                throw std::runtime_error(describeErrno("Failed to sync directory", directory));
+        }
+
+        /**
+         * @brief Writes into a temp file beside the target and renames it over the target on commit
+         *
+         * The temp file is removed if the writer is destroyed without a successful commit,
+         * so readers only ever observe the old or the new file contents.
+         */
+        class AtomicFileWriter
+        {
+        public:
+            AtomicFileWriter(const std::string& targetPath, const AtomicWriteSettings& settings)
+                : targetPath_(targetPath), settings_(settings)
+            {
+                buffer_.reserve(settings.bufferSize);
+                openTempFile();
+                preserveTargetMode();
+            }
+
+            ~AtomicFileWriter()
+            {
+                if (committed_)
+                    return;
+                file_.reset();
+                ::unlink(tempPath_.c_str());
+            }
+
+            AtomicFileWriter(const AtomicFileWriter&) = delete;
+            AtomicFileWriter& operator=(const AtomicFileWriter&) = delete;
+
+            void write(std::string_view data)
+            {
+                if (buffer_.size() + data.size() > settings_.bufferSize)
+                    flush();
+
+                if (data.size() >= settings_.bufferSize)
+                    writeAll(file_.get(), data.data(), data.size(), tempPath_);
+                else
+                    buffer_.insert(buffer_.end(), data.begin(), data.end());
+            }
+
+            void commit()
+            {
+                flush();
+                syncFileDescriptor(file_.get(), settings_.fsyncPolicy, tempPath_);
+
+                TraceSpan closing(TraceEventKind::Close, tempPath_);
+                if (::close(file_.release()) != 0)
+                    throw std::runtime_error(describeErrno("Failed to close file", tempPath_));
+
+                if (::rename(tempPath_.c_str(), targetPath_.c_str()) != 0)
+                    throw std::runtime_error(describeErrno("Failed to replace file", targetPath_));
+
+                committed_ = true;
+                if (settings_.fsyncPolicy == FsyncPolicy::Full)
+                    syncParentDirectory(targetPath_);
+            }
+
+        private:
+            void openTempFile()
+            {
+                const int flags = O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC;
+                for (int attempt = 0; attempt < 16 && !file_; ++attempt)
+                {
+                    tempPath_ = makeTempPath(targetPath_);
+                    TraceSpan span(TraceEventKind::Open, tempPath_);
+                    file_.reset(::open(tempPath_.c_str(), flags, 0666));
+                    if (!file_ && errno != EEXIST)
+                        break;
+                }
+
+                if (!file_)
+                    throw std::runtime_error(describeErrno("Failed to create temp file", tempPath_));
+            }
+
+            void preserveTargetMode()
+            {
+                struct stat targetStat;
+                if (::stat(targetPath_.c_str(), &targetStat) == 0)
+                    ::fchmod(file_.get(), targetStat.st_mode & 07777);
+            }
+
+            void flush()
+            {
+                writeAll(file_.get(), buffer_.data(), buffer_.size(), tempPath_);
+                buffer_.clear();
+            }
+
+            std::string targetPath_;
+            std::string tempPath_;
+            AtomicWriteSettings settings_;
+            FileDescriptor file_;
+            std::vector<char> buffer_;
+            bool committed_ = false;
+        };
+#else
+        /**
+         * @brief Portable fallback: buffered ofstream into a temp file, then filesystem rename
+         *
+         * Fsync policies are not available through the standard library and are ignored.
+         */
+        class AtomicFileWriter
+        {
+        public:
+            AtomicFileWriter(const std::string& targetPath, const AtomicWriteSettings& settings)
+                : targetPath_(targetPath), tempPath_(makeTempPath(targetPath)),
+                  buffer_(std::max<size_t>(settings.bufferSize, 1))
+            {
+                file_.rdbuf()->pubsetbuf(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+                file_.open(tempPath_, std::ios::binary | std::ios::trunc);
+                if (!file_.is_open())
+                    throw std::runtime_error("Failed to create temp file: " + tempPath_);
+            }
+
+            ~AtomicFileWriter()
+            {
+                if (committed_)
+                    return;
+                file_.close();
+                std::error_code ignored;
+                std::filesystem::remove(tempPath_, ignored);
+            }
+
+            AtomicFileWriter(const AtomicFileWriter&) = delete;
+            AtomicFileWriter& operator=(const AtomicFileWriter&) = delete;
+
+            void write(std::string_view data)
+            {
+                file_.write(data.data(), static_cast<std::streamsize>(data.size()));
+            }
+
+            void commit()
+            {
+                file_.close();
+                if (file_.fail())
+                    throw std::runtime_error("Failed to write file: " + tempPath_);
+
+                std::filesystem::rename(tempPath_, targetPath_);
+                committed_ = true;
+            }
+
+        private:
+            std::string targetPath_;
+            std::string tempPath_;
+            std::vector<char> buffer_;
+            std::ofstream file_;
+            bool committed_ = false;
+        };
+#endif
+    }
+
+    /**
+     * @brief Replaces a file's contents atomically via a temp file and rename
+     *
+     * Readers observe either the previous contents or the complete new contents, never
+     * a partially written file.
+     *
+     * @param filePath Path to the file to create or replace
+     * @param content Complete new contents of the file
+     * @param settings Buffer size and fsync policy (see AtomicWriteSettings)
+     * @throws std::runtime_error if the temp file cannot be written or renamed
+     */
+    inline void writeFileAtomic(const std::string& filePath, std::string_view content,
+                                const AtomicWriteSettings& settings = {})
+    {
+        internal::ScopedOperation operation(Operation::WriteFileAtomic);
+        internal::AtomicFileWriter writer(filePath, settings);
+        writer.write(content);
+        writer.commit();
+    }
+
+    /**
+     * @brief Replaces a file with the given lines atomically, each followed by the separator
+     *
+     * @param filePath Path to the file to create or replace
+     * @param lines Lines to write, in order
+     * @param separator Character written after every line
+     * @param settings Buffer size and fsync policy (see AtomicWriteSettings)
+     * @throws std::runtime_error if the temp file cannot be written or renamed
+     */
+    inline void writeLinesAtomic(const std::string& filePath, const std::vector<std::string>& lines,
+                                 char separator = '\n', const AtomicWriteSettings& settings = {})
+    {
+        internal::ScopedOperation operation(Operation::WriteFileAtomic);
+        operation.addLines(lines.size());
+        internal::AtomicFileWriter writer(filePath, settings);
+        for (const auto& line : lines)
+        {
+            writer.write(line);
+            writer.write(std::string_view(&separator, 1));
+        }
+        writer.commit();
+    }
+
+    // ============================================================================
+    // Bulk Line Writing Functions
+    // ============================================================================
+
+    namespace internal
+    {
+#if STEVENS_FILE_LIB_POSIX
+#if defined(IOV_MAX)
+        constexpr size_t maxIovecsPerWrite = IOV_MAX;
+#else
+        constexpr size_t maxIovecsPerWrite = 1024;
+#endif
+
+        inline void skipWrittenIovecs(iovec*& current, size_t& remaining, size_t written)
+        {
+            while (remaining > 0 && written >= current->iov_len)
+            {
+                written -= current->iov_len;
+                ++current;
+                --remaining;
+            }
+
+            if (remaining == 0)
+                return;
+            current->iov_base = static_cast<char*>(current->iov_base) + written;
+            current->iov_len -= written;
+        }
+
+        inline void writeIovecsAll(int fd, std::vector<iovec>& batch, const std::string& filePath)
+        {
+            iovec* current = batch.data();
+            size_t remaining = batch.size();
+
+            while (remaining > 0)
+            {
+                TraceSpan span(TraceEventKind::Write, filePath);
+                ssize_t written = ::writev(fd, current, static_cast<int>(remaining));
+                if (written < 0)
+                {
+                    span.cancel();
+                    if (errno == EINTR)
+                        continue;
+                    throw std::runtime_error(describeErrno("Failed to write file", filePath));
+                }
+
+                noteWrite(static_cast<size_t>(written));
+                span.setBytes(static_cast<uint64_t>(written));
+                skipWrittenIovecs(current, remaining, static_cast<size_t>(written));
+            }
+
+            batch.clear();
+        }
+
+        /**
+         * @brief Writes lines and separators with gathered writev calls, without concatenating them
+         */
+        inline void writeLinesVectored(int fd, const std::vector<std::string>& lines,
+                                       const char& separator, const std::string& filePath)
+        {
+            std::vector<iovec> batch;
+            batch.reserve(maxIovecsPerWrite);
+
+            for (const auto& line : lines)
+            {
+                batch.push_back({const_cast<char*>(line.data()), line.size()});
+                batch.push_back({const_cast<char*>(&separator), 1});
+
+                if (batch.size() + 2 > maxIovecsPerWrite)
+                    writeIovecsAll(fd, batch, filePath);
+            }
+
+            writeIovecsAll(fd, batch, filePath);
+        }
+#endif
+    }
+
+    /**
+     * @brief Writes a vector of lines to a file, each followed by the separator
+     *
+     * The inverse of loadFileIntoVector. The whole file is written through a single open,
+     * with lines gathered into batched writev calls instead of being concatenated.
+     *
+     * @param filePath Path to the file
+     * @param lines Lines to write, in order
+     * @param separator Character written after every line
+     * @param mode Whether to truncate or append to an existing file
+     * @throws std::runtime_error if the file cannot be opened or written
+     */
+    inline void writeLinesToFile(const std::string& filePath, const std::vector<std::string>& lines,
+                                 char separator = '\n', WriteMode mode = WriteMode::Truncate)
+    {
+        internal::ScopedOperation operation(Operation::WriteLinesToFile);
+        operation.addLines(lines.size());
+
+#if STEVENS_FILE_LIB_POSIX
+        const int flags = O_WRONLY | O_CREAT | O_CLOEXEC |
+                          (mode == WriteMode::Append ? O_APPEND : O_TRUNC);
+
+        internal::FileDescriptor file;
+        {
+            internal::TraceSpan opening(TraceEventKind::Open, filePath);
+            file.reset(::open(filePath.c_str(), flags, 0666));
+        }
+        if (!file)
+            throw std::runtime_error(internal::describeErrno("Failed to open file for writing", filePath));
+
+        internal::writeLinesVectored(file.get(), lines, separator, filePath);
+
+        // Some filesystems (NFS, delayed allocation) only report a failed write on close
+        internal::TraceSpan closing(TraceEventKind::Close, filePath);
+        if (::close(file.release()) != 0)
+            throw std::runtime_error(internal::describeErrno("Failed to close file", filePath));
+#else
+        std::ofstream file(filePath, std::ios::binary |
+                           (mode == WriteMode::Append ? std::ios::app : std::ios::trunc));
+        if (!file.is_open())
+            throw std::runtime_error("Failed to open file for writing: " + filePath);
+
+        for (const auto& line : lines)
+            file << line << separator;
+
+        file.flush();
+        file.close();
+        if (file.fail())
+            throw std::runtime_error("Failed to write file: " + filePath);
+#endif
+    }
+
+    // ============================================================================
+    // Line Filtering Helper Functions
+    // ============================================================================
+
+    namespace internal
+    {
+        inline bool shouldSkipLine(std::string_view line, const LoadSettings& settings)
+        {
+            if (settings.skipEmptyLines && line.empty())
+                return true;
+
+            for (const auto& prefix : settings.skipIfStartsWith)
+            {
+                if (startsWith(line, prefix))
+                    return true;
+            }
+
+            for (const auto& substring : settings.skipIfContains)
+            {
+                if (contains(line, substring))
+                    return true;
+            }
+
+            return false;
+        }
+
+        inline bool shouldIncludeFile(const std::filesystem::path& filePath,
+                                     const ListFilesSettings& settings)
+        {
+            const std::string filename = filePath.filename().string();
+            const std::string extension = filePath.extension().string();
+
+            if (settings.excludeFiles.count(filename) > 0)
+                return false;
+
+            if (!settings.targetExtensions.empty())
+                return settings.targetExtensions.count(extension) > 0;
+
+            if (!settings.excludeExtensions.empty())
+                return settings.excludeExtensions.count(extension) == 0;
+
+            return true;
+        }
+    }
+
+    // ============================================================================
+    // Chunked File Reading (internal)
+    // ============================================================================
+
+    namespace internal
+    {
+        constexpr size_t readAlignment = 4096;
+
+        inline size_t roundUpToAlignment(size_t size)
+        {
+            return (size + readAlignment - 1) / readAlignment * readAlignment;
+        }
+
+        /**
+         * @brief Heap buffer aligned for O_DIRECT reads
+         */
+        class AlignedBuffer
+        {
+        public:
+            explicit AlignedBuffer(size_t size = 0)
+                : data_(size == 0 ? nullptr : static_cast<char*>(
+                      ::operator new(size, std::align_val_t(readAlignment)))),
+                  size_(size)
+            {
+            }
+
+            ~AlignedBuffer()
+            {
+                if (data_ != nullptr)
+                    ::operator delete(data_, std::align_val_t(readAlignment));
+            }
+
+            AlignedBuffer(const AlignedBuffer&) = delete;
+            AlignedBuffer& operator=(const AlignedBuffer&) = delete;
+
+            char* data() { return data_; }
+            size_t size() const { return size_; }
+
+        private:
+            char* data_;
+            size_t size_;
+        };
+
+#if STEVENS_FILE_LIB_POSIX
+        /**
+         * @brief Reads a file in large chunks (or as one mapping) with kernel access hints
+         */
+        class ChunkReader
+        {
+        public:
+            ChunkReader(const std::string& filePath, const ReadOptions& options)
+                : filePath_(filePath), options_(options)
+            {
+                openFile();
+                adviseAccessPattern();
+
+                if (options_.memoryMap && fileSize_ > 0)
+                    mapFile();
+                else
+                    buffer_ = std::make_unique<AlignedBuffer>(chooseBufferSize());
+            }
+
+            ~ChunkReader()
+            {
+                if (mapping_ != nullptr)
+                    ::munmap(mapping_, fileSize_);
+                if (options_.dropCache)
+                    dropPages(0, 0); // A zero length covers the whole file
+
+                TraceSpan span(TraceEventKind::Close, filePath_);
+                file_.reset();
+            }
+
+            ChunkReader(const ChunkReader&) = delete;
+            ChunkReader& operator=(const ChunkReader&) = delete;
+
+            /**
+             * @brief Returns the next chunk of the file, or an empty view at end of file
+             *
+             * The returned view stays valid until the next call.
+             */
+            std::string_view next()
+            {
+                if (mapping_ != nullptr)
+                    return nextMapped();
+
+                // The previous chunk has been consumed by the time the caller asks for more
+                if (options_.dropCache && offset_ > droppedOffset_)
+                    dropConsumedPages();
+
+                TraceSpan span(TraceEventKind::Read, filePath_);
+                ssize_t count = readChunk();
+                if (count < 0)
+                {
+                    span.cancel();
+                    throw std::runtime_error(describeErrno("Failed to read file", filePath_));
+                }
+
+                noteRead(static_cast<size_t>(count));
+                span.setBytes(static_cast<uint64_t>(count));
+                offset_ += static_cast<size_t>(count);
+                return std::string_view(buffer_->data(), static_cast<size_t>(count));
+            }
+
+            int descriptor() const { return file_.get(); }
+            size_t offset() const { return offset_; }
+            bool mapsWholeFile() const { return mapping_ != nullptr; }
+
+        private:
+            void openFile()
+            {
+                TraceSpan span(TraceEventKind::Open, filePath_);
+                int flags = O_RDONLY | O_CLOEXEC;
+#if defined(O_DIRECT)
+                if (options_.directIo && !options_.memoryMap)
+                    file_.reset(::open(filePath_.c_str(), flags | O_DIRECT));
+#endif
+                if (!file_)
+                    file_.reset(::open(filePath_.c_str(), flags));
+
+                struct stat fileStat;
+                if (!file_ || ::fstat(file_.get(), &fileStat) != 0 || S_ISDIR(fileStat.st_mode))
+                    throw std::invalid_argument("Failed to open file for reading: " + filePath_);
+
+                regularFile_ = S_ISREG(fileStat.st_mode);
+                fileSize_ = regularFile_ ? static_cast<size_t>(fileStat.st_size) : 0;
+            }
+
+            void adviseAccessPattern()
+            {
+#if defined(POSIX_FADV_SEQUENTIAL)
+                if (options_.accessPattern == ReadAccessPattern::Sequential)
+                    ::posix_fadvise(file_.get(), 0, 0, POSIX_FADV_SEQUENTIAL);
+                if (options_.accessPattern == ReadAccessPattern::NoReuse)
+                    ::posix_fadvise(file_.get(), 0, 0, POSIX_FADV_NOREUSE);
+#endif
+            }
+
+            size_t chooseBufferSize() const
+            {
+                size_t size = std::max(options_.bufferSize, readAlignment);
+                if (regularFile_)
+                    size = std::min(size, fileSize_ + 1);
+                return roundUpToAlignment(size);
+            }
+
+            void mapFile()
+            {
+                TraceSpan span(TraceEventKind::Read, filePath_);
+                span.setBytes(fileSize_);
+                void* mapping = ::mmap(nullptr, fileSize_, PROT_READ, MAP_PRIVATE, file_.get(), 0);
+                if (mapping == MAP_FAILED)
+                    throw std::runtime_error(describeErrno("Failed to map file", filePath_));
+
+                noteRead(0);
+                mapping_ = static_cast<char*>(mapping);
+                if (options_.accessPattern == ReadAccessPattern::Sequential)
+                    ::madvise(mapping_, fileSize_, MADV_SEQUENTIAL);
+#if defined(MADV_HUGEPAGE)
+                if (options_.hugePages)
+                    ::madvise(mapping_, fileSize_, MADV_HUGEPAGE);
+#endif
+            }
+
+            void dropPages([[maybe_unused]] size_t begin, [[maybe_unused]] size_t end)
+            {
+#if defined(POSIX_FADV_DONTNEED)
+                ::posix_fadvise(file_.get(), static_cast<off_t>(begin),
+                                static_cast<off_t>(end - begin), POSIX_FADV_DONTNEED);
+#endif
+            }
+
+            void dropConsumedPages()
+            {
+                // Only whole pages are dropped, so restart from the last partially consumed one
+                dropPages(droppedOffset_, offset_);
+                droppedOffset_ = offset_ / readAlignment * readAlignment;
+            }
+
+            std::string_view nextMapped()
+            {
+                if (offset_ == fileSize_)
+                    return {};
+                noteRead(fileSize_, 0);
+                offset_ = fileSize_;
+                return std::string_view(mapping_, fileSize_);
+            }
+
+            ssize_t readChunk()
+            {
+                while (true)
+                {
+                    ssize_t count = ::read(file_.get(), buffer_->data(), buffer_->size());
+                    if (count >= 0 || !retryableReadError())
+                        return count;
+                }
+            }
+
+            bool retryableReadError()
+            {
+                // Captured first: the fcntl calls below may overwrite errno
+                const int error = errno;
+                if (error == EINTR)
+                    return true;
+#if defined(O_DIRECT)
+                // Filesystems without O_DIRECT support reject the read: fall back to buffered I/O
+                int flags = ::fcntl(file_.get(), F_GETFL);
+                if (error == EINVAL && flags != -1 && (flags & O_DIRECT) != 0)
+                    return ::fcntl(file_.get(), F_SETFL, flags & ~O_DIRECT) == 0;
+#endif
+                return false;
+            }
+
+            std::string filePath_;
+            ReadOptions options_;
+            FileDescriptor file_;
+            std::unique_ptr<AlignedBuffer> buffer_;
+            char* mapping_ = nullptr;
+            size_t fileSize_ = 0;
+            size_t offset_ = 0;
+            size_t droppedOffset_ = 0;
+            bool regularFile_ = false;
+        };
+#else
+        /**
+         * @brief Portable fallback: reads a file in large chunks through an ifstream
+         *
+         * The stream is opened in text mode, like the std::getline loop it replaced, so
+         * platforms that translate line endings still return CRLF lines without the '\r'.
+         */
+        class ChunkReader
+        {
+        public:
+            ChunkReader(const std::string& filePath, const ReadOptions& options)
+                : filePath_(filePath),
+                  file_(openStreamTraced<std::ifstream>(filePath, std::ios::in)),
+                  buffer_(std::max<size_t>(options.bufferSize, readAlignment))
+            {
+                if (!file_.is_open())
+                    throw std::invalid_argument("Failed to open file for reading: " + filePath);
+            }
+
+            std::string_view next()
+            {
+                TraceSpan span(TraceEventKind::Read, filePath_);
+                file_.read(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+                size_t count = static_cast<size_t>(file_.gcount());
+                noteRead(count);
+                span.setBytes(count);
+                offset_ += count;
+                return std::string_view(buffer_.data(), count);
+            }
+
+            size_t offset() const { return offset_; }
+            bool mapsWholeFile() const { return false; }
+
+        private:
+            std::string filePath_;
+            std::ifstream file_;
+            std::vector<char> buffer_;
+            size_t offset_ = 0;
+        };
+#endif
+
+        /**
+         * @brief Splits a ChunkReader's output into separator-delimited records
+         *
+         * Matches std::getline semantics: every separator ends a record, and trailing
+         * text after the last separator forms a final record. Records are returned as
+         * views that stay valid until the next call.
+         */
+        class RecordReader
+        {
+        public:
+            RecordReader(const std::string& filePath, char separator, const ReadOptions& options)
+                : chunks_(filePath, options), separator_(separator)
+            {
+            }
+
+            bool next(std::string_view& record)
+            {
+                if (carryEmitted_)
+                {
+                    carry_.clear();
+                    carryEmitted_ = false;
+                }
+
+                while (!finished_)
+                {
+                    if (takeRecordFromChunk(record))
+                        return true;
+                    if (refillChunk())
+                        continue;
+                    return takeFinalRecord(record);
+                }
+                return false;
+            }
+
+            ChunkReader& chunks() { return chunks_; }
+
+        private:
+            bool takeRecordFromChunk(std::string_view& record)
+            {
+                std::string_view rest = chunk_.substr(position_);
+                if (rest.empty())
+                    return false;
+
+                const void* found = std::memchr(rest.data(), separator_, rest.size());
+                if (found == nullptr)
+                {
+                    carry_.append(rest);
+                    position_ = chunk_.size();
+                    return false;
+                }
+
+                size_t length = static_cast<const char*>(found) - rest.data();
+                position_ += length + 1;
+                record = emit(rest.substr(0, length));
+                return true;
+            }
+
+            std::string_view emit(std::string_view piece)
+            {
+                if (carry_.empty())
+                    return piece;
+
+                carry_.append(piece);
+                carryEmitted_ = true;
+                return carry_;
+            }
+
+            bool refillChunk()
+            {
+                chunk_ = chunks_.next();
+                position_ = 0;
+                return !chunk_.empty();
+            }
+
+            bool takeFinalRecord(std::string_view& record)
+            {
+                finished_ = true;
+                if (carry_.empty())
+                    return false;
+
+                carryEmitted_ = true;
+                record = carry_;
+                return true;
+            }
+
+            ChunkReader chunks_;
+            char separator_;
+            std::string_view chunk_;
+            size_t position_ = 0;
+            std::string carry_;
+            bool carryEmitted_ = false;
+            bool finished_ = false;
+        };
+
+        inline bool isAsciiSpace(char c)
+        {
+            return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+        }
+
+        /**
+         * @brief Parses one whitespace-delimited token the way repeated operator>> calls would
+         *
+         * Each number ends where its digits end and the next one starts right there, so
+         * "1-2" yields 1 and -2 and "3+4" yields 3 and 4.
+         *
+         * @return false once parsing must stop (text that does not start a number)
+         */
+        inline bool appendParsedInt(std::string_view token, std::vector<int>& numbers)
+        {
+            while (!token.empty())
+            {
+                std::string_view number = token;
+                if (number.size() > 1 && number[0] == '+' && number[1] != '-' && number[1] != '+')
+                    number.remove_prefix(1);
+
+                int value = 0;
+                auto [end, error] = std::from_chars(number.data(), number.data() + number.size(), value);
+                if (error != std::errc())
+                    return false;
+
+                numbers.push_back(value);
+                token.remove_prefix(static_cast<size_t>(end - token.data()));
+            }
+            return true;
+        }
+
+        template<typename TokenCallback>
+        bool emitToken(std::string_view piece, std::string& carry, TokenCallback& onToken)
+        {
+            if (carry.empty())
+                return piece.empty() || onToken(piece);
+
+            carry.append(piece);
+            bool keepGoing = onToken(std::string_view(carry));
+            carry.clear();
+            return keepGoing;
+        }
+
+        /**
+         * @brief Feeds whitespace-delimited tokens of a chunk to onToken, carrying partial tokens
+         */
+        template<typename TokenCallback>
+        bool scanTokens(std::string_view chunk, std::string& carry, TokenCallback& onToken)
+        {
+            size_t start = 0;
+            for (size_t position = 0; position < chunk.size(); ++position)
+            {
+                if (!isAsciiSpace(chunk[position]))
+                    continue;
+                if (!emitToken(chunk.substr(start, position - start), carry, onToken))
+                    return false;
+                start = position + 1;
+            }
+
+            carry.append(chunk.substr(start));
+            return true;
+        }
+
+        /**
+         * @brief Calls onLine with every record that passes the LoadSettings filters
+         *
+         * The views passed to onLine are only valid for the duration of the call.
+         */
+        template<typename LineCallback>
+        void forEachLine(const std::string& filePath, const LoadSettings& settings,
+                         const ReadOptions& options, LineCallback&& onLine)
+        {
+            RecordReader reader(filePath, settings.separator, options);
+            std::string_view line;
+
+            while (reader.next(line))
+            {
+                if (!shouldSkipLine(line, settings))
+                    onLine(line);
+            }
+        }
+
+        inline std::vector<std::string> loadLines(const std::string& filePath,
+                                                  const LoadSettings& settings,
+                                                  const ReadOptions& options)
+        {
+            std::vector<std::string> lines;
+            forEachLine(filePath, settings, options, [&lines](std::string_view line) { lines.emplace_back(line); });
+            return lines;
+        }
+    }
+
+    // ============================================================================
+    // File Reading Functions
+    // ============================================================================
+
+    /**
+     * @brief Loads file contents line-by-line into a vector of strings
+     *
+     * @param filePath Path to the file
+     * @param settingsMap Settings for filtering lines (see LoadSettings)
+     * @param separator Character used to separate lines
+     * @param skipEmptyLines If true, skip empty lines
+     * @param readOptions Buffer size and kernel hints (see ReadOptions)
+     * @return std::vector<std::string> Vector containing file lines
+     * @throws std::invalid_argument if file cannot be opened
+     */
+    inline std::vector<std::string> loadFileIntoVector(
+        const std::string& filePath,
+        const std::unordered_map<std::string, std::vector<std::string>>& settingsMap = {},
+        char separator = '\n',
+        bool skipEmptyLines = true,
+        const ReadOptions& readOptions = {})
+    {
+        internal::ScopedOperation operation(Operation::LoadFileIntoVector);
+        LoadSettings settings(settingsMap, separator, skipEmptyLines);
+        std::vector<std::string> lines = internal::loadLines(filePath, settings, readOptions);
+        operation.addLines(lines.size());
+        return lines;
+    }
+
+    /**
+     * @brief Loads file contents into a vector of integers
+     *
+     * @param filePath Path to the file
+     * @param settingsMap Settings for filtering lines (currently unused but kept for API compatibility)
+     * @param separator Character used to separate values
+     * @param skipEmptyLines If true, skip empty lines
+     * @param readOptions Buffer size and kernel hints (see ReadOptions)
+     * @return std::vector<int> Vector containing integer values
+     * @throws std::invalid_argument if file cannot be opened
+     */
+    inline std::vector<int> loadFileIntoVectorOfInts(
+        const std::string& filePath,
+        [[maybe_unused]] const std::unordered_map<std::string, std::vector<std::string>>& settingsMap = {},
+        [[maybe_unused]] char separator = '\n',
+        [[maybe_unused]] bool skipEmptyLines = true,
+        const ReadOptions& readOptions = {})
+    {
+        internal::ScopedOperation operation(Operation::LoadFileIntoVectorOfInts);
+        internal::ChunkReader reader(filePath, readOptions);
+        std::vector<int> numbers;
+        std::string carry;
+        auto onToken = [&numbers](std::string_view token) { return internal::appendParsedInt(token, numbers); };
+
+        for (auto chunk = reader.next(); !chunk.empty(); chunk = reader.next())
+        {
+            if (!internal::scanTokens(chunk, carry, onToken))
+            {
+                operation.addLines(numbers.size());
+                return numbers;
+            }
+        }
+
+        internal::emitToken({}, carry, onToken);
+        operation.addLines(numbers.size());
+        return numbers;
+    }
+
+    /**
+     * @brief Returns a random line from a file
+     *
+     * Uses single-pass reservoir sampling, so only the currently selected line is kept.
+     * Safe to call from several threads at once: each thread draws from its own
+     * generator, seeded independently from std::random_device.
+     *
+     * @param filePath Path to the file
+     * @param separator Character used to separate lines
+     * @param readOptions Buffer size and kernel hints (see ReadOptions)
+     * @return std::string A random line from the file
+     * @throws std::invalid_argument if file cannot be opened
+     * @throws std::runtime_error if file is empty
+     */
+    inline std::string getRandomFileLine(const std::string& filePath, char separator = '\n',
+                                         const ReadOptions& readOptions = {})
+    {
+        // One generator per thread, seeded on first use, so concurrent calls never share state
+        static thread_local std::mt19937 generator(std::random_device{}());
+
+        internal::ScopedOperation operation(Operation::GetRandomFileLine);
+        internal::RecordReader reader(filePath, separator, readOptions);
+        std::string selected;
+        std::string_view line;
+        size_t lineCount = 0;
+
+        while (reader.next(line))
+        {
+            std::uniform_int_distribution<size_t> distribution(0, lineCount++);
+            if (distribution(generator) == 0)
+                selected.assign(line);
+        }
+
+        operation.addLines(lineCount);
+        if (lineCount == 0)
+            throw std::runtime_error("Cannot get random line from empty file: " + filePath);
+
+        return selected;
+    }
+
+    /**
+     * @brief Pulls filtered lines from a file one at a time, without materializing the file
+     *
+     * Applies the same filtering as loadFileIntoVector. Each line is returned as a view
+     * that stays valid until the next call to next().
+     */
+    class LineReader
+    {
+    public:
+        /**
+         * @throws std::invalid_argument if file cannot be opened
+         */
+        explicit LineReader(const std::string& filePath, LoadSettings settings = {},
+                            const ReadOptions& readOptions = {})
+            : settings_(std::move(settings)), records_(filePath, settings_.separator, readOptions)
+        {
+        }
+
+        /**
+         * @brief Advances to the next line that passes the filters
+         * @return false at end of file
+         */
+        bool next(std::string_view& line)
+        {
+            while (records_.next(line))
+            {
+                if (!internal::shouldSkipLine(line, settings_))
+                    return true;
+            }
+            return false;
+        }
+
+    private:
+        LoadSettings settings_;
+        internal::RecordReader records_;
+    };
+
+    // ============================================================================
+    // Delimited Record Loading
+    // ============================================================================
+
+    /**
+     * @brief Location of one field inside DelimitedTable::buffer()
+     */
+    struct FieldSpan
+    {
+        size_t offset = 0;
+        size_t length = 0;
+    };
+
+    /**
+     * @brief Columnar result of loadDelimitedFile
+     *
+     * All unquoted field bytes live in one contiguous buffer; each column holds one
+     * FieldSpan per row. Rows with fewer fields than the widest row have empty
+     * fields in the missing columns.
+     */
+    class DelimitedTable
+    {
+    public:
+        size_t rowCount() const { return rowCount_; }
+        size_t columnCount() const { return columns_.size(); }
+
+        const std::string& buffer() const { return buffer_; }
+        const std::vector<std::string>& header() const { return header_; }
+        const std::vector<FieldSpan>& columnSpans(size_t column) const { return columns_.at(column); }
+
+        std::string_view field(size_t row, size_t column) const
+        {
+            const FieldSpan& span = columns_.at(column).at(row);
+            return std::string_view(buffer_).substr(span.offset, span.length);
+        }
+
+        std::vector<std::string_view> column(size_t column) const
+        {
+            std::vector<std::string_view> fields;
+            fields.reserve(rowCount_);
+            for (const FieldSpan& span : columns_.at(column))
+                fields.push_back(std::string_view(buffer_).substr(span.offset, span.length));
+            return fields;
+        }
+
+        /**
+         * @brief Index of the header column with the given name
+         * @throws std::out_of_range if no header column has that name
+         */
+        size_t columnIndex(std::string_view name) const
+        {
+            auto found = std::find(header_.begin(), header_.end(), name);
+            if (found == header_.end())
+                throw std::out_of_range("No such column: " + std::string(name));
+            return static_cast<size_t>(found - header_.begin());
+        }
+
+    private:
+        friend class internal::DelimitedParser;
+
+        std::string buffer_;
+        std::vector<std::vector<FieldSpan>> columns_;
+        std::vector<std::string> header_;
+        size_t rowCount_ = 0;
+    };
+
+    namespace internal
+    {
+        inline uint64_t broadcastByte(char value)
+        {
+            return 0x0101010101010101ULL * static_cast<unsigned char>(value);
+        }
+
+        inline bool hasZeroByte(uint64_t word)
+        {
+            return ((word - 0x0101010101010101ULL) & ~word & 0x8080808080808080ULL) != 0;
+        }
+
+        /**
+         * @brief Position of the first occurrence of either byte at or after from, or npos
+         *
+         * Scans eight bytes per step with SWAR (SIMD-within-a-register) comparisons.
+         */
+        inline size_t findFirstOf(std::string_view text, size_t from, char first, char second)
+        {
+            const uint64_t firstPattern = broadcastByte(first);
+            const uint64_t secondPattern = broadcastByte(second);
+            size_t position = from;
+
+            for (; position + 8 <= text.size(); position += 8)
+            {
+                uint64_t word;
+                std::memcpy(&word, text.data() + position, sizeof(word));
+                if (hasZeroByte(word ^ firstPattern) || hasZeroByte(word ^ secondPattern))
+                    break;
+            }
+
+            for (; position < text.size(); ++position)
+            {
+                if (text[position] == first || text[position] == second)
+                    return position;
+            }
+
+            return std::string_view::npos;
+        }
+
+        /**
+         * @brief Hands the whole file to onContents as one view, mapping it where possible
+         */
+        template<typename ContentsCallback>
+        void withFileContents(const std::string& filePath, ReadOptions options, ContentsCallback&& onContents)
+        {
+            options.memoryMap = !options.directIo;
+            ChunkReader reader(filePath, options);
+
+            if (reader.mapsWholeFile())
+            {
+                onContents(reader.next());
+                return;
+            }
+
+            std::string contents;
+            for (auto chunk = reader.next(); !chunk.empty(); chunk = reader.next())
+                contents.append(chunk);
+            onContents(std::string_view(contents));
+        }
+
+        /**
+         * @brief Single-pass CSV/TSV parser writing unquoted fields into a DelimitedTable
+         */
+        class DelimitedParser
+        {
+        public:
+            DelimitedParser(std::string_view input, const DelimitedSettings& settings, DelimitedTable& table)
+                : input_(input), settings_(settings), table_(table),
+                  expectHeader_(settings.hasHeader)
+            {
+                table_.buffer_.reserve(input.size());
+            }
+
+            void parse()
+            {
+                while (position_ < input_.size())
+                    parseRecord();
+            }
+
+        private:
+            void parseRecord()
+            {
+                if (shouldSkipRecord())
+                {
+                    skipRecord();
+                    return;
+                }
+
+                fieldIndex_ = 0;
+                while (parseField())
+                    ++fieldIndex_;
+                finishRow();
+            }
+
+            bool shouldSkipRecord() const
+            {
+                std::string_view rest = input_.substr(position_);
+                if (settings_.skipEmptyLines && isEmptyRecord(rest))
+                    return true;
+
+                for (const auto& prefix : settings_.skipIfStartsWith)
+                {
+                    if (startsWith(rest, prefix))
+                        return true;
+                }
+                return false;
+            }
+
+            bool isEmptyRecord(std::string_view rest) const
+            {
+                if (rest[0] == settings_.recordSeparator)
+                    return true;
+                return stripsCarriageReturn() && startsWith(rest, "\r\n");
+            }
+
+            bool stripsCarriageReturn() const
+            {
+                return settings_.recordSeparator == '\n';
+            }
+
+            void skipRecord()
+            {
+                size_t end = input_.find(settings_.recordSeparator, position_);
+                position_ = end == std::string_view::npos ? input_.size() : end + 1;
+            }
+
+            /**
+             * @brief Parses one field and consumes its terminator
+             * @return true if another field follows in the same record
+             */
+            bool parseField()
+            {
+                size_t begin = table_.buffer_.size();
+                if (settings_.quoting && position_ < input_.size() && input_[position_] == settings_.quote)
+                    parseQuoted();
+                parseUnquoted();
+                storeField(FieldSpan{begin, table_.buffer_.size() - begin});
+
+                if (position_ >= input_.size())
+                    return false;
+                return input_[position_++] == settings_.fieldSeparator;
+            }
+
+            void parseUnquoted()
+            {
+                size_t end = findFirstOf(input_, position_, settings_.fieldSeparator, settings_.recordSeparator);
+                if (end == std::string_view::npos)
+                    end = input_.size();
+
+                std::string_view run = input_.substr(position_, end - position_);
+                bool endsRecord = end == input_.size() || input_[end] == settings_.recordSeparator;
+                if (endsRecord && stripsCarriageReturn() && !run.empty() && run.back() == '\r')
+                    run.remove_suffix(1);
+
+                table_.buffer_.append(run);
+                position_ = end;
+            }
+
+            void parseQuoted()
+            {
+                ++position_;
+                while (position_ < input_.size())
+                {
+                    size_t quote = input_.find(settings_.quote, position_);
+                    if (quote == std::string_view::npos)
+                        quote = input_.size();
+
+                    table_.buffer_.append(input_.substr(position_, quote - position_));
+                    position_ = std::min(quote + 1, input_.size());
+                    if (!isEscapedQuote(quote))
+                        return;
+
+                    table_.buffer_.push_back(settings_.quote);
+                    ++position_;
+                }
+            }
+
+            bool isEscapedQuote(size_t quote) const
+            {
+                return quote + 1 < input_.size() && input_[quote + 1] == settings_.quote;
+            }
+
+            void storeField(const FieldSpan& span)
+            {
+                auto& columns = table_.columns_;
+                if (fieldIndex_ == columns.size())
+                    columns.emplace_back(table_.rowCount_);
+                columns[fieldIndex_].push_back(span);
+            }
+
+            void finishRow()
+            {
+                for (size_t column = fieldIndex_ + 1; column < table_.columns_.size(); ++column)
+                    table_.columns_[column].push_back(FieldSpan{});
+
+                ++table_.rowCount_;
+                if (expectHeader_)
+                    moveRowToHeader();
+            }
+
+            void moveRowToHeader()
+            {
+                for (size_t column = 0; column < table_.columns_.size(); ++column)
+                    table_.header_.emplace_back(table_.field(0, column));
+
+                for (auto& column : table_.columns_)
+                    column.clear();
+                table_.buffer_.clear();
+                table_.rowCount_ = 0;
+                expectHeader_ = false;
+            }
+
+            std::string_view input_;
+            const DelimitedSettings& settings_;
+            DelimitedTable& table_;
+            size_t position_ = 0;
+            size_t fieldIndex_ = 0;
+            bool expectHeader_;
+        };
+    }
+
+    /**
+     * @brief Loads a CSV/TSV file into a columnar table in a single pass
+     *
+     * Fields are unquoted directly into one contiguous buffer, so no per-line or
+     * per-field strings are allocated.
+     *
+     * @param filePath Path to the file
+     * @param settings Separators, quoting and record filtering (see DelimitedSettings)
+     * @param readOptions Buffer size and kernel hints (see ReadOptions)
+     * @return DelimitedTable Parsed fields, addressable by row and column
+     * @throws std::invalid_argument if file cannot be opened
+     */
+    inline DelimitedTable loadDelimitedFile(const std::string& filePath,
+                                            const DelimitedSettings& settings = {},
+                                            const ReadOptions& readOptions = {})
+    {
+        internal::ScopedOperation operation(Operation::LoadDelimitedFile);
+        DelimitedTable table;
+        internal::withFileContents(filePath, readOptions, [&](std::string_view contents)
+        {
+            internal::DelimitedParser(contents, settings, table).parse();
+        });
+        operation.addLines(table.rowCount());
+        return table;
+    }
+
+    // ============================================================================
+    // Membership Set Loading
+    // ============================================================================
+
+    /**
+     * @brief Append-only storage for strings, handing out stable string_views
+     *
+     * Strings are packed into large blocks, so storing many short strings costs one
+     * allocation per block rather than one per string. Views stay valid for the
+     * lifetime of the arena, including after it is moved.
+     */
+    class StringArena
+    {
+    public:
+        explicit StringArena(size_t blockSize = 64 << 10) : blockSize_(std::max<size_t>(blockSize, 1)) {}
+
+        StringArena(StringArena&& other) noexcept
+            : blocks_(std::move(other.blocks_)), cursor_(std::exchange(other.cursor_, nullptr)),
+              remaining_(std::exchange(other.remaining_, 0)), blockSize_(other.blockSize_),
+              bytesUsed_(std::exchange(other.bytesUsed_, 0))
+        {
+        }
+
+        StringArena& operator=(StringArena&& other) noexcept
+        {
+            blocks_ = std::move(other.blocks_);
+            cursor_ = std::exchange(other.cursor_, nullptr);
+            remaining_ = std::exchange(other.remaining_, 0);
+            blockSize_ = other.blockSize_;
+            bytesUsed_ = std::exchange(other.bytesUsed_, 0);
+            return *this;
+        }
+
+        StringArena(const StringArena&) = delete;
+        StringArena& operator=(const StringArena&) = delete;
+
+        /**
+         * @brief Copies text into the arena and returns a view of the copy
+         */
+        std::string_view store(std::string_view text)
+        {
+            // Before the first block exists cursor_ is null, and memcpy from/to null is undefined
+            if (text.empty())
+                return std::string_view();
+            if (text.size() > remaining_)
+                allocateBlock(text.size());
+
+            char* destination = cursor_;
+            std::memcpy(destination, text.data(), text.size());
+            cursor_ += text.size();
+            remaining_ -= text.size();
+            bytesUsed_ += text.size();
+            return std::string_view(destination, text.size());
+        }
+
+        size_t bytesUsed() const { return bytesUsed_; }
+
+    private:
+        void allocateBlock(size_t minimumSize)
+        {
+            size_t size = std::max(minimumSize, blockSize_);
+            blocks_.push_back(std::make_unique<char[]>(size));
+            cursor_ = blocks_.back().get();
+            remaining_ = size;
+        }
+
+        std::vector<std::unique_ptr<char[]>> blocks_;
+        char* cursor_ = nullptr;
+        size_t remaining_ = 0;
+        size_t blockSize_;
+        size_t bytesUsed_ = 0;
+    };
+
+    namespace internal
+    {
+        /**
+         * @brief Hash that is never zero, so zero can mark an empty open-addressing slot
+         *
+         * The marker is the top bit, which never reaches the slot index; setting a low bit
+         * instead would send every key to an odd home slot.
+         */
+        inline uint64_t occupiedHash(std::string_view text)
+        {
+            return static_cast<uint64_t>(std::hash<std::string_view>{}(text)) | (uint64_t{1} << 63);
+        }
+
+        inline size_t tableCapacityFor(size_t count)
+        {
+            size_t capacity = 16;
+            while (capacity * 7 < count * 10)
+                capacity *= 2;
+            return capacity;
+        }
+
+        /**
+         * @brief Index of key's slot, or of the empty slot where it would be inserted
+         *
+         * Slot must have `key` and `hash` members; the table size must be a power of two.
+         */
+        template<typename Slot>
+        size_t probeSlot(const std::vector<Slot>& slots, std::string_view key, uint64_t hash)
+        {
+            const size_t mask = slots.size() - 1;
+            size_t index = static_cast<size_t>(hash) & mask;
+
+            while (slots[index].hash != 0 && (slots[index].hash != hash || slots[index].key != key))
+                index = (index + 1) & mask;
+
+            return index;
+        }
+
+        /**
+         * @brief Doubles an open-addressing table, reinserting every occupied slot
+         */
+        template<typename Slot>
+        void growSlots(std::vector<Slot>& slots)
+        {
+            std::vector<Slot> previous(slots.size() * 2);
+            previous.swap(slots);
+
+            for (const Slot& slot : previous)
+            {
+                if (slot.hash != 0)
+                    slots[probeSlot(slots, slot.key, slot.hash)] = slot;
+            }
+        }
+    }
+
+    /**
+     * @brief Open-addressing hash set of string_views whose bytes live in a StringArena
+     *
+     * Uses linear probing over a flat slot array (kept at most 70% full) that stores each
+     * key's hash beside its view, so lookups touch one cache line in the common case.
+     */
+    class FlatStringSet
+    {
+    public:
+        FlatStringSet() : slots_(internal::tableCapacityFor(0)) {}
+
+        /**
+         * @brief Inserts a copy of text unless it is already present
+         * @return true if text was inserted
+         */
+        bool insert(std::string_view text)
+        {
+            if ((size_ + 1) * 10 > slots_.size() * 7)
+                internal::growSlots(slots_);
+
+            uint64_t hash = internal::occupiedHash(text);
+            Slot& slot = slots_[internal::probeSlot(slots_, text, hash)];
+            if (slot.hash != 0)
+                return false;
+
+            slot = Slot{arena_.store(text), hash};
+            ++size_;
+            return true;
+        }
+
+        bool contains(std::string_view text) const
+        {
+            return slots_[internal::probeSlot(slots_, text, internal::occupiedHash(text))].hash != 0;
+        }
+
+        size_t size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+
+        /**
+         * @brief Calls onValue with every element, in unspecified order
+         */
+        template<typename ValueCallback>
+        void forEach(ValueCallback&& onValue) const
+        {
+            for (const Slot& slot : slots_)
+            {
+                if (slot.hash != 0)
+                    onValue(slot.key);
+            }
+        }
+
+    private:
+        struct Slot
+        {
+            std::string_view key;
+            uint64_t hash = 0;
+        };
+
+        StringArena arena_;
+        std::vector<Slot> slots_;
+        size_t size_ = 0;
+    };
+
+    /**
+     * @brief Immutable sorted set of string_views searched in Eytzinger (BFS) order
+     *
+     * Elements are laid out as an implicit binary search tree, so the first levels of
+     * every search share the same few cache lines instead of jumping across a sorted array.
+     */
+    class SortedStringSet
+    {
+    public:
+        SortedStringSet() = default;
+
+        /**
+         * @brief Builds the set from views into arena; duplicates are removed
+         */
+        SortedStringSet(StringArena arena, std::vector<std::string_view> values)
+            : arena_(std::move(arena))
+        {
+            std::sort(values.begin(), values.end());
+            values.erase(std::unique(values.begin(), values.end()), values.end());
+
+            layout_.resize(values.size() + 1);
+            fillLayout(values, 0, 1);
+        }
+
+        bool contains(std::string_view text) const
+        {
+            size_t index = 1;
+            const size_t count = size();
+            while (index <= count)
+                index = 2 * index + (layout_[index] < text ? 1 : 0);
+
+            // Undo the trailing right turns and the final left turn to reach the lower bound
+            while ((index & 1) != 0)
+                index >>= 1;
+            index >>= 1;
+
+            return index != 0 && layout_[index] == text;
+        }
+
+        size_t size() const { return layout_.empty() ? 0 : layout_.size() - 1; }
+        bool empty() const { return size() == 0; }
+
+        /**
+         * @brief Calls onValue with every element in ascending order
+         */
+        template<typename ValueCallback>
+        void forEach(ValueCallback&& onValue) const
+        {
+            visitInOrder(1, onValue);
+        }
+
+    private:
+        size_t fillLayout(const std::vector<std::string_view>& sorted, size_t next, size_t index)
+        {
+            if (index >= layout_.size())
+                return next;
+
+            next = fillLayout(sorted, next, 2 * index);
+            layout_[index] = sorted[next++];
+            return fillLayout(sorted, next, 2 * index + 1);
+        }
+
+        template<typename ValueCallback>
+        void visitInOrder(size_t index, ValueCallback& onValue) const
+        {
+            if (index >= layout_.size())
+                return;
+
+            visitInOrder(2 * index, onValue);
+            onValue(layout_[index]);
+            visitInOrder(2 * index + 1, onValue);
+        }
+
+        StringArena arena_;
+        std::vector<std::string_view> layout_;
+    };
+
+    /**
+     * @brief Loads a file's distinct lines into a FlatStringSet in one pass
+     *
+     * Each distinct line is copied once, into the set's arena; duplicates are never stored.
+     *
+     * @param filePath Path to the file
+     * @param settingsMap Settings for filtering lines (see LoadSettings)
+     * @param separator Character used to separate lines
+     * @param skipEmptyLines If true, skip empty lines
+     * @param readOptions Buffer size and kernel hints (see ReadOptions)
+     * @return FlatStringSet Set of distinct lines
+     * @throws std::invalid_argument if file cannot be opened
+     */
+    inline FlatStringSet loadFileIntoHashSet(
+        const std::string& filePath,
+        const std::unordered_map<std::string, std::vector<std::string>>& settingsMap = {},
+        char separator = '\n',
+        bool skipEmptyLines = true,
+        const ReadOptions& readOptions = {})
+    {
+        internal::ScopedOperation operation(Operation::LoadFileIntoSet);
+        LoadSettings settings(settingsMap, separator, skipEmptyLines);
+        FlatStringSet set;
+        internal::forEachLine(filePath, settings, readOptions, [&](std::string_view line)
+        {
+            set.insert(line);
+            operation.addLines(1);
+        });
+        return set;
+    }
+
+    /**
+     * @brief Loads a file's distinct lines into a SortedStringSet
+     *
+     * @param filePath Path to the file
+     * @param settingsMap Settings for filtering lines (see LoadSettings)
+     * @param separator Character used to separate lines
+     * @param skipEmptyLines If true, skip empty lines
+     * @param readOptions Buffer size and kernel hints (see ReadOptions)
+     * @return SortedStringSet Sorted set of distinct lines
+     * @throws std::invalid_argument if file cannot be opened
+     */
+    inline SortedStringSet loadFileIntoSortedSet(
+        const std::string& filePath,
+        const std::unordered_map<std::string, std::vector<std::string>>& settingsMap = {},
+        char separator = '\n',
+        bool skipEmptyLines = true,
+        const ReadOptions& readOptions = {})
+    {
+        internal::ScopedOperation operation(Operation::LoadFileIntoSet);
+        LoadSettings settings(settingsMap, separator, skipEmptyLines);
+        StringArena arena;
+        std::vector<std::string_view> values;
+
+        internal::forEachLine(filePath, settings, readOptions, [&](std::string_view line)
+        {
+            values.push_back(arena.store(line));
+        });
+        operation.addLines(values.size());
+
+        return SortedStringSet(std::move(arena), std::move(values));
+    }
+
+    // ============================================================================
+    // Key-Value Map Loading
+    // ============================================================================
+
+    /**
+     * @brief Open-addressing string map whose keys and values live in a StringArena
+     *
+     * Uses the same linear-probing layout as FlatStringSet. Assigning to an existing key
+     * replaces its value; the old value's bytes remain in the arena until it is destroyed.
+     */
+    class FlatStringMap
+    {
+    public:
+        FlatStringMap() : slots_(internal::tableCapacityFor(0)) {}
+
+        /**
+         * @brief Inserts key, or replaces its value if already present
+         * @return true if key was newly inserted
+         */
+        bool insertOrAssign(std::string_view key, std::string_view value)
+        {
+            if ((size_ + 1) * 10 > slots_.size() * 7)
+                internal::growSlots(slots_);
+
+            uint64_t hash = internal::occupiedHash(key);
+            Slot& slot = slots_[internal::probeSlot(slots_, key, hash)];
+            bool inserted = slot.hash == 0;
+            if (inserted)
+            {
+                slot.key = arena_.store(key);
+                slot.hash = hash;
+                ++size_;
+            }
+
+            slot.value = arena_.store(value);
+            return inserted;
+        }
+
+        /**
+         * @brief Pointer to key's value, or nullptr if key is absent
+         */
+        const std::string_view* find(std::string_view key) const
+        {
+            const Slot& slot = slots_[internal::probeSlot(slots_, key, internal::occupiedHash(key))];
+            return slot.hash == 0 ? nullptr : &slot.value;
+        }
+
+        /**
+         * @brief Value for key
+         * @throws std::out_of_range if key is absent
+         */
+        std::string_view at(std::string_view key) const
+        {
+            const std::string_view* value = find(key);
+            if (value == nullptr)
+                throw std::out_of_range("No such key: " + std::string(key));
+            return *value;
+        }
+
+        bool contains(std::string_view key) const { return find(key) != nullptr; }
+        size_t size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+
+        /**
+         * @brief Calls onEntry(key, value) for every entry, in unspecified order
+         */
+        template<typename EntryCallback>
+        void forEach(EntryCallback&& onEntry) const
+        {
+            for (const Slot& slot : slots_)
+            {
+                if (slot.hash != 0)
+                    onEntry(slot.key, slot.value);
+            }
+        }
+
+    private:
+        struct Slot
+        {
+            std::string_view key;
+            std::string_view value;
+            uint64_t hash = 0;
+        };
+
+        StringArena arena_;
+        std::vector<Slot> slots_;
+        size_t size_ = 0;
+    };
+
+    /**
+     * @brief Loads a key-value file (e.g. `key=value` or `key<TAB>value`) into a FlatStringMap in one pass
+     *
+     * Each line is split at the first key-value separator. Lines without the separator
+     * are ignored, and later duplicates of a key replace earlier ones. Keys and values
+     * are not trimmed.
+     *
+     * @param filePath Path to the file
+     * @param keyValueSeparator Character between a key and its value
+     * @param settingsMap Settings for filtering lines (see LoadSettings)
+     * @param separator Character used to separate lines
+     * @param skipEmptyLines If true, skip empty lines
+     * @param readOptions Buffer size and kernel hints (see ReadOptions)
+     * @return FlatStringMap Map from keys to values
+     * @throws std::invalid_argument if file cannot be opened
+     */
+    inline FlatStringMap loadFileIntoMap(
+        const std::string& filePath,
+        char keyValueSeparator = '=',
+        const std::unordered_map<std::string, std::vector<std::string>>& settingsMap = {},
+        char separator = '\n',
+        bool skipEmptyLines = true,
+        const ReadOptions& readOptions = {})
+    {
+        internal::ScopedOperation operation(Operation::LoadFileIntoMap);
+        LoadSettings settings(settingsMap, separator, skipEmptyLines);
+        FlatStringMap map;
+
+        internal::forEachLine(filePath, settings, readOptions, [&](std::string_view line)
+        {
+            operation.addLines(1);
+            size_t split = line.find(keyValueSeparator);
+            if (split != std::string_view::npos)
+                map.insertOrAssign(line.substr(0, split), line.substr(split + 1));
+        });
+
+        return map;
+    }
+
+    // ============================================================================
+    // Binary Line Snapshots
+    // ============================================================================
+
+    namespace internal
+    {
+        /**
+         * @brief Streaming 64-bit checksum that consumes input eight bytes at a time
+         *
+         * The result depends only on the concatenated bytes, not on how they are split
+         * across update calls.
+         */
+        class Checksum
+        {
+        public:
+            void update(const char* data, size_t size)
+            {
+                while (size > 0 && pendingSize_ > 0)
+                {
+                    appendPending(*data++);
+                    --size;
+                }
+
+                for (; size >= sizeof(uint64_t); data += sizeof(uint64_t), size -= sizeof(uint64_t))
+                {
+                    uint64_t word;
+                    std::memcpy(&word, data, sizeof(word));
+                    mix(word);
+                }
+
+                for (; size > 0; --size)
+                    appendPending(*data++);
+            }
+
+            uint64_t finish() const
+            {
+                uint64_t word = 0;
+                std::memcpy(&word, pending_, pendingSize_);
+                uint64_t hash = state_;
+                hash = (hash ^ word ^ (static_cast<uint64_t>(pendingSize_) << 56)) * 0x9E3779B97F4A7C15ULL;
+                return hash ^ (hash >> 29);
+            }
+
+        private:
+            void appendPending(char byte)
+            {
+                pending_[pendingSize_++] = byte;
+                if (pendingSize_ < sizeof(uint64_t))
+                    return;
+
+                uint64_t word;
+                std::memcpy(&word, pending_, sizeof(word));
+                mix(word);
+                pendingSize_ = 0;
+            }
+
+            void mix(uint64_t word)
+            {
+                state_ = (state_ ^ word) * 0xFF51AFD7ED558CCDULL;
+                state_ ^= state_ >> 32;
+            }
+
+            uint64_t state_ = 0xCBF29CE484222325ULL;
+            char pending_[sizeof(uint64_t)] = {};
+            size_t pendingSize_ = 0;
+        };
+
+        /**
+         * @brief Fixed-size header at the start of every line snapshot file
+         */
+        struct SnapshotHeader
+        {
+            char magic[8] = {'S', 'F', 'L', 'L', 'I', 'N', 'E', 'S'};
+            uint32_t version = 1;
+            uint32_t byteOrderMark = 0x01020304;
+            uint64_t lineCount = 0;
+            uint64_t blobSize = 0;
+            uint64_t checksum = 0;
+            uint64_t reserved = 0;
+        };
+
+        static_assert(sizeof(SnapshotHeader) == 48, "SnapshotHeader must have no padding");
+
+        inline void appendOffset(Checksum& checksum, uint64_t offset)
+        {
+            checksum.update(reinterpret_cast<const char*>(&offset), sizeof(offset));
+        }
+
+        /**
+         * @brief Read-only view of a whole file: memory-mapped on POSIX, loaded into memory elsewhere
+         */
+        class MappedFile
+        {
+        public:
+            explicit MappedFile(const std::string& filePath)
+            {
+#if STEVENS_FILE_LIB_POSIX
+                FileDescriptor file(::open(filePath.c_str(), O_RDONLY | O_CLOEXEC));
+                struct stat fileStat;
+                if (!file || ::fstat(file.get(), &fileStat) != 0 || !S_ISREG(fileStat.st_mode))
+                    throw std::invalid_argument("Failed to open file for reading: " + filePath);
+
+                size_ = static_cast<size_t>(fileStat.st_size);
+                if (size_ == 0)
+                    return;
+
+                void* mapping = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file.get(), 0);
+                if (mapping == MAP_FAILED)
+                    throw std::runtime_error(describeErrno("Failed to map file", filePath));
+                data_ = static_cast<const char*>(mapping);
+#else
+                withFileContents(filePath, ReadOptions(), [this](std::string_view contents) { contents_ = contents; });
+                data_ = contents_.data();
+                size_ = contents_.size();
+#endif
+            }
+
+            ~MappedFile()
+            {
+#if STEVENS_FILE_LIB_POSIX
+                if (data_ != nullptr)
+                    ::munmap(const_cast<char*>(data_), size_);
+#endif
+            }
+
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            const char* data() const { return data_; }
+            size_t size() const { return size_; }
+
+        private:
+            const char* data_ = nullptr;
+            size_t size_ = 0;
+#if !STEVENS_FILE_LIB_POSIX
+            std::string contents_;
+#endif
+        };
+    }
+
+    /**
+     * @brief Saves lines to a versioned, checksummed binary snapshot for loading with LineSnapshot
+     *
+     * The file holds a header, lineCount + 1 offsets and one blob of line bytes, written
+     * atomically. Lines are stored exactly, so filtered results from loadFileIntoVector
+     * can be persisted once and reopened without parsing.
+     *
+     * @tparam Lines Container whose elements convert to std::string_view
+     * @param snapshotPath Path of the snapshot file to create or replace
+     * @param lines Lines to store, in order
+     * @param settings Buffer size and fsync policy (see AtomicWriteSettings)
+     * @throws std::runtime_error if the snapshot cannot be written
+     */
+    template<typename Lines>
+    void saveLineSnapshot(const std::string& snapshotPath, const Lines& lines,
+                          const AtomicWriteSettings& settings = {})
+    {
+        internal::SnapshotHeader header;
+        internal::Checksum checksum;
+
+        internal::appendOffset(checksum, 0);
+        for (const auto& line : lines)
+        {
+            header.blobSize += std::string_view(line).size();
+            internal::appendOffset(checksum, header.blobSize);
+            ++header.lineCount;
+        }
+        for (const auto& line : lines)
+            checksum.update(std::string_view(line).data(), std::string_view(line).size());
+        header.checksum = checksum.finish();
+
+        internal::AtomicFileWriter writer(snapshotPath, settings);
+        writer.write(std::string_view(reinterpret_cast<const char*>(&header), sizeof(header)));
+
+        uint64_t offset = 0;
+        writer.write(std::string_view(reinterpret_cast<const char*>(&offset), sizeof(offset)));
+        for (const auto& line : lines)
+        {
+            offset += std::string_view(line).size();
+            writer.write(std::string_view(reinterpret_cast<const char*>(&offset), sizeof(offset)));
+        }
+        for (const auto& line : lines)
+            writer.write(line);
+
+        writer.commit();
+    }
+
+    /**
+     * @brief Zero-parse, memory-mapped view of a snapshot written by saveLineSnapshot
+     *
+     * Lines are returned as string_views into the mapping and stay valid for the lifetime
+     * of the LineSnapshot.
+     */
+    class LineSnapshot
+    {
+    public:
+        class iterator
+        {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = std::string_view;
+
+            iterator() = default;
+            iterator(const LineSnapshot* snapshot, size_t index) : snapshot_(snapshot), index_(index) {}
+
+            std::string_view operator*() const { return (*snapshot_)[index_]; }
+            std::string_view operator[](difference_type offset) const { return *(*this + offset); }
+
+            iterator& operator++() { ++index_; return *this; }
+            iterator operator++(int) { iterator previous = *this; ++index_; return previous; }
+            iterator& operator--() { --index_; return *this; }
+            iterator operator--(int) { iterator previous = *this; --index_; return previous; }
+
+            iterator& operator+=(difference_type offset)
+            {
+                index_ = static_cast<size_t>(static_cast<difference_type>(index_) + offset);
+                return *this;
+            }
+            iterator& operator-=(difference_type offset) { return *this += -offset; }
+            iterator operator+(difference_type offset) const { iterator moved = *this; return moved += offset; }
+            iterator operator-(difference_type offset) const { iterator moved = *this; return moved -= offset; }
+            friend iterator operator+(difference_type offset, const iterator& it) { return it + offset; }
+
+            difference_type operator-(const iterator& other) const
+            {
+                return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+            }
+
+            bool operator==(const iterator& other) const { return index_ == other.index_; }
+            bool operator!=(const iterator& other) const { return index_ != other.index_; }
+            bool operator<(const iterator& other) const { return index_ < other.index_; }
+            bool operator>(const iterator& other) const { return index_ > other.index_; }
+            bool operator<=(const iterator& other) const { return index_ <= other.index_; }
+            bool operator>=(const iterator& other) const { return index_ >= other.index_; }
+
+        private:
+            const LineSnapshot* snapshot_ = nullptr;
+            size_t index_ = 0;
+        };
+
+        /**
+         * @brief Maps a snapshot and validates its header and layout
+         *
+         * The layout check always runs: it bounds the header counts by the file size and
+         * confirms the offsets never decrease and end at the blob size.
+         *
+         * @param snapshotPath Path to the snapshot file
+         * @param verifyChecksum If true, also checksum every byte (O(file size)); skip only for trusted files
+         * @throws std::invalid_argument if the file cannot be opened
+         * @throws std::runtime_error if the file is not a valid snapshot
+         */
+        explicit LineSnapshot(const std::string& snapshotPath, bool verifyChecksum = true)
+            : file_(std::make_unique<internal::MappedFile>(snapshotPath))
+        {
+            readHeader(snapshotPath);
+            if (verifyChecksum && computeChecksum() != header_.checksum)
+                throw std::runtime_error("Snapshot checksum mismatch: " + snapshotPath);
+        }
+
+        size_t size() const { return static_cast<size_t>(header_.lineCount); }
+        bool empty() const { return size() == 0; }
+
+        std::string_view operator[](size_t index) const
+        {
+            uint64_t begin = offsetAt(index);
+            uint64_t end = offsetAt(index + 1);
+            return std::string_view(blob_ + begin, static_cast<size_t>(end - begin));
+        }
+
+        std::string_view at(size_t index) const
+        {
+            if (index >= size())
+                throw std::out_of_range("Snapshot line index out of range");
+            return (*this)[index];
+        }
+
+        iterator begin() const { return iterator(this, 0); }
+        iterator end() const { return iterator(this, size()); }
+
+    private:
+        void readHeader(const std::string& snapshotPath)
+        {
+            const internal::SnapshotHeader expected;
+            if (file_->size() < sizeof(header_))
+                throw std::runtime_error("Not a line snapshot: " + snapshotPath);
+
+            std::memcpy(&header_, file_->data(), sizeof(header_));
+            if (std::memcmp(header_.magic, expected.magic, sizeof(expected.magic)) != 0 ||
+                header_.byteOrderMark != expected.byteOrderMark)
+                throw std::runtime_error("Not a line snapshot: " + snapshotPath);
+
+            if (header_.version != expected.version)
+                throw std::runtime_error("Unsupported snapshot version: " + snapshotPath);
+
+            offsets_ = file_->data() + sizeof(header_);
+            if (!hasConsistentLayout())
+                throw std::runtime_error("Truncated or corrupt snapshot: " + snapshotPath);
+        }
+
+        /**
+         * @brief Checks the header counts against the file size, then every offset once
+         *
+         * Sizes are compared by subtraction so crafted counts cannot wrap around. After this,
+         * operator[] and computeChecksum never read outside the mapping.
+         */
+        bool hasConsistentLayout()
+        {
+            const uint64_t payload = file_->size() - sizeof(header_);
+            if (header_.lineCount >= payload / sizeof(uint64_t))
+                return false;
+
+            const uint64_t offsetBytes = (header_.lineCount + 1) * sizeof(uint64_t);
+            if (header_.blobSize != payload - offsetBytes)
+                return false;
+
+            if (offsetAt(0) != 0 || offsetAt(size()) != header_.blobSize)
+                return false;
+            for (size_t index = 0; index < size(); ++index)
+            {
+                if (offsetAt(index) > offsetAt(index + 1))
+                    return false;
+            }
+
+            blob_ = offsets_ + offsetBytes;
+            return true;
+        }
+
+        uint64_t computeChecksum() const
+        {
+            internal::Checksum checksum;
+            checksum.update(offsets_, static_cast<size_t>(blob_ - offsets_));
+            checksum.update(blob_, static_cast<size_t>(header_.blobSize));
+            return checksum.finish();
+        }
+
+        uint64_t offsetAt(size_t index) const
+        {
+            uint64_t offset;
+            std::memcpy(&offset, offsets_ + index * sizeof(uint64_t), sizeof(offset));
+            return offset;
+        }
+
+        std::unique_ptr<internal::MappedFile> file_;
+        internal::SnapshotHeader header_;
+        const char* offsets_ = nullptr;
+        const char* blob_ = nullptr;
+    };
+
+    // ============================================================================
+    // File Load Cache
+    // ============================================================================
+
+    namespace internal
+    {
+        /**
+         * @brief Identity and version of a file as reported by a single stat call
+         */
+        struct FileStamp
+        {
+            uint64_t size = 0;
+            int64_t modifiedNanoseconds = 0;
+            uint64_t inode = 0;
+            uint64_t device = 0;
+
+            bool operator==(const FileStamp& other) const
+            {
+                return size == other.size && modifiedNanoseconds == other.modifiedNanoseconds &&
+                       inode == other.inode && device == other.device;
+            }
+
+            bool operator!=(const FileStamp& other) const { return !(*this == other); }
+        };
+
+#if STEVENS_FILE_LIB_POSIX
+        inline bool statFile(const std::string& filePath, FileStamp& stamp)
+        {
+            struct stat fileStat;
+            if (::stat(filePath.c_str(), &fileStat) != 0)
+                return false;
+
+#if defined(__APPLE__)
+            const struct timespec& modified = fileStat.st_mtimespec;
+#else
+            const struct timespec& modified = fileStat.st_mtim;
+#endif
+            stamp.size = static_cast<uint64_t>(fileStat.st_size);
+            stamp.modifiedNanoseconds = static_cast<int64_t>(modified.tv_sec) * 1000000000 + modified.tv_nsec;
+            stamp.inode = static_cast<uint64_t>(fileStat.st_ino);
+            stamp.device = static_cast<uint64_t>(fileStat.st_dev);
+            return true;
+        }
+#else
+        inline bool statFile(const std::string& filePath, FileStamp& stamp)
+        {
+            std::error_code error;
+            auto size = std::filesystem::file_size(filePath, error);
+            auto modified = std::filesystem::last_write_time(filePath, error);
+            if (error)
+                return false;
+
+            stamp.size = static_cast<uint64_t>(size);
+            stamp.modifiedNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                modified.time_since_epoch()).count();
+            return true;
+        }
+#endif
+
+        inline std::string describeLoadSettings(const LoadSettings& settings)
+        {
+            std::string description(1, settings.separator);
+            description += settings.skipEmptyLines ? '1' : '0';
+
+            for (const auto& prefix : settings.skipIfStartsWith)
+                description.append("\x1fs").append(prefix);
+            for (const auto& substring : settings.skipIfContains)
+                description.append("\x1f" "c").append(substring);
+
+            return description;
+        }
+
+        inline size_t estimateBytes(const std::vector<std::string>& lines)
+        {
+            size_t bytes = sizeof(lines) + lines.capacity() * sizeof(std::string);
+            for (const auto& line : lines)
+                bytes += line.capacity() > sizeof(std::string) ? line.capacity() : 0;
+            return bytes;
+        }
+    }
+
+    /**
+     * @brief Memoizes loaded files, revalidated with one stat per lookup and bounded by an LRU byte budget
+     *
+     * Entries are keyed by path and load settings and are reused while the file's size,
+     * modification time and inode are unchanged. Results are shared, immutable handles
+     * that stay valid after eviction. All member functions are thread-safe.
+     */
+    class FileCache
+    {
+    public:
+        using Lines = std::vector<std::string>;
+        using Handle = std::shared_ptr<const Lines>;
+
+        struct Stats
+        {
+            size_t hits = 0;
+            size_t misses = 0;
+            size_t evictions = 0;
+            size_t entries = 0;
+            size_t bytes = 0;
+        };
+
+        explicit FileCache(size_t byteBudget = 256 << 20) : byteBudget_(byteBudget) {}
+
+        FileCache(const FileCache&) = delete;
+        FileCache& operator=(const FileCache&) = delete;
+
+        /**
+         * @brief The process-wide cache used by loadFileIntoVectorCached
+         */
+        static FileCache& global()
+        {
+            static FileCache cache;
+            return cache;
+        }
+
+        /**
+         * @brief Returns the file's filtered lines, loading them only if the cached copy is stale
+         *
+         * @throws std::invalid_argument if file cannot be opened
+         */
+        Handle loadLines(const std::string& filePath, const LoadSettings& settings = {},
+                         const ReadOptions& readOptions = {})
+        {
+            internal::FileStamp stamp;
+            if (!internal::statFile(filePath, stamp))
+                throw std::invalid_argument("Failed to open file for reading: " + filePath);
+
+            std::string key = filePath + '\0' + internal::describeLoadSettings(settings);
+            if (Handle cached = findFresh(key, stamp))
+                return cached;
+
+            // Loaded without the lock held; a concurrent load of the same key is harmless
+            auto lines = std::make_shared<const Lines>(internal::loadLines(filePath, settings, readOptions));
+            store(key, stamp, lines);
+            return lines;
+        }
+
+        void setByteBudget(size_t byteBudget)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            byteBudget_ = byteBudget;
+            evictOverBudget();
+        }
+
+        size_t byteBudget() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return byteBudget_;
+        }
+
+        /**
+         * @brief Drops every cached entry for a path, whatever settings it was loaded with
+         */
+        void invalidate(const std::string& filePath)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            const std::string prefix = filePath + '\0';
+            for (auto entry = recency_.begin(); entry != recency_.end();)
+                entry = internal::startsWith(entry->key, prefix) ? erase(entry) : std::next(entry);
+        }
+
+        void clear()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            recency_.clear();
+            index_.clear();
+            stats_.bytes = 0;
+        }
+
+        Stats stats() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            Stats snapshot = stats_;
+            snapshot.entries = recency_.size();
+            return snapshot;
+        }
+
+    private:
+        struct Entry
+        {
+            std::string key;
+            internal::FileStamp stamp;
+            Handle lines;
+            size_t bytes;
+        };
+
+        using EntryList = std::list<Entry>;
+
+        Handle findFresh(const std::string& key, const internal::FileStamp& stamp)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto found = index_.find(key);
+            if (found == index_.end() || found->second->stamp != stamp)
+            {
+                ++stats_.misses;
+                return nullptr;
+            }
+
+            ++stats_.hits;
+            recency_.splice(recency_.begin(), recency_, found->second);
+            return found->second->lines;
+        }
+
+        void store(const std::string& key, const internal::FileStamp& stamp, const Handle& lines)
+        {
+            size_t bytes = internal::estimateBytes(*lines);
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            auto existing = index_.find(key);
+            if (existing != index_.end())
+                erase(existing->second);
+            if (bytes > byteBudget_)
+                return;
+
+            recency_.push_front(Entry{key, stamp, lines, bytes});
+            index_[key] = recency_.begin();
+            stats_.bytes += bytes;
+            evictOverBudget();
+        }
+
+        void evictOverBudget()
+        {
+            while (stats_.bytes > byteBudget_ && !recency_.empty())
+            {
+                erase(std::prev(recency_.end()));
+                ++stats_.evictions;
+            }
+        }
+
+        EntryList::iterator erase(EntryList::iterator entry)
+        {
+            stats_.bytes -= entry->bytes;
+            index_.erase(entry->key);
+            return recency_.erase(entry);
+        }
+
+        mutable std::mutex mutex_;
+        EntryList recency_;
+        std::unordered_map<std::string, EntryList::iterator> index_;
+        size_t byteBudget_;
+        Stats stats_;
+    };
+
+    /**
+     * @brief Loads a file through the process-wide FileCache
+     *
+     * Takes the same arguments as loadFileIntoVector, but repeated calls for an unchanged
+     * file return the same shared, immutable result after a single stat.
+     *
+     * @return FileCache::Handle Shared pointer to the filtered lines
+     * @throws std::invalid_argument if file cannot be opened
+     */
+    inline FileCache::Handle loadFileIntoVectorCached(
+        const std::string& filePath,
+        const std::unordered_map<std::string, std::vector<std::string>>& settingsMap = {},
+        char separator = '\n',
+        bool skipEmptyLines = true,
+        const ReadOptions& readOptions = {})
+    {
+        LoadSettings settings(settingsMap, separator, skipEmptyLines);
+        return FileCache::global().loadLines(filePath, settings, readOptions);
+    }
+
+    // ============================================================================
+    // Hot-Reloading Watched Files
+    // ============================================================================
+
+    /**
+     * @brief Keeps an up-to-date parsed snapshot of a file, rebuilt in the background when it changes
+     *
+     * A watcher thread polls the file with one stat per interval and, when its size,
+     * modification time or inode changes, re-parses it off the reader threads. New
+     * versions are published atomically: get() never blocks on a reload, and snapshots
+     * already handed out stay valid. If the parser throws, the previous snapshot is kept
+     * and the error is available from lastError().
+     *
+     * @tparam T Parsed representation; defaults to the lines from loadFileIntoVector
+     */
+    template<typename T = std::vector<std::string>>
+    class WatchedFile
+    {
+    public:
+        using Parser = std::function<T(const std::string& filePath)>;
+        using Snapshot = std::shared_ptr<const T>;
+
+        /**
+         * @brief Loads the file synchronously and starts watching it
+         *
+         * @param filePath Path to the file
+         * @param parser Builds a T from the file; may be omitted when T is std::vector<std::string>
+         * @param pollInterval How often the file is checked for changes
+         * @throws std::invalid_argument if no parser is given for a custom T
+         * @throws Any exception thrown by the initial parse
+         */
+        explicit WatchedFile(const std::string& filePath, Parser parser = Parser(),
+                             std::chrono::milliseconds pollInterval = std::chrono::seconds(1))
+            : filePath_(filePath), parser_(parser ? std::move(parser) : defaultParser()),
+              pollInterval_(pollInterval)
+        {
+            internal::statFile(filePath_, stamp_);
+            snapshot_.store(std::make_shared<const T>(parser_(filePath_)));
+            watcher_ = std::thread([this] { watch(); });
+        }
+
+        ~WatchedFile()
+        {
+            {
+                std::lock_guard<std::mutex> lock(stateMutex_);
+                stopping_ = true;
+            }
+            stopCondition_.notify_one();
+            watcher_.join();
+        }
+
+        WatchedFile(const WatchedFile&) = delete;
+        WatchedFile& operator=(const WatchedFile&) = delete;
+
+        /**
+         * @brief The current snapshot; never null and never blocks on a reload
+         */
+        Snapshot get() const { return snapshot_.load(); }
+
+        /**
+         * @brief Number of snapshots published after the initial load
+         */
+        uint64_t version() const { return version_.load(std::memory_order_acquire); }
+
+        /**
+         * @brief The exception from the most recent failed reload, or null
+         */
+        std::exception_ptr lastError() const
+        {
+            std::lock_guard<std::mutex> lock(stateMutex_);
+            return lastError_;
+        }
+
+        const std::string& filePath() const { return filePath_; }
+
+    private:
+        static Parser defaultParser()
+        {
+            if constexpr (std::is_same_v<T, std::vector<std::string>>)
+                return [](const std::string& filePath) { return loadFileIntoVector(filePath); };
+            else
+                throw std::invalid_argument("WatchedFile requires a parser for this type");
+        }
+
+        void watch()
+        {
+            std::unique_lock<std::mutex> lock(stateMutex_);
+            while (!stopCondition_.wait_for(lock, pollInterval_, [this] { return stopping_; }))
+            {
+                lock.unlock();
+                reloadIfChanged();
+                lock.lock();
+            }
+        }
+
+        void reloadIfChanged()
+        {
+            internal::FileStamp current;
+            if (!internal::statFile(filePath_, current) || current == stamp_)
+                return;
+
+            // Remember the stamp even on failure, so a broken file is not re-parsed every poll
+            stamp_ = current;
+            try
+            {
+                snapshot_.store(std::make_shared<const T>(parser_(filePath_)));
+                version_.fetch_add(1, std::memory_order_acq_rel);
+                recordError(nullptr);
+            }
+            catch (...)
+            {
+                recordError(std::current_exception());
+            }
+        }
+
+        void recordError(std::exception_ptr error)
+        {
+            std::lock_guard<std::mutex> lock(stateMutex_);
+            lastError_ = error;
+        }
+
+        std::string filePath_;
+        Parser parser_;
+        std::chrono::milliseconds pollInterval_;
+        internal::FileStamp stamp_;
+        internal::AtomicSharedPtr<const T> snapshot_;
+        std::atomic<uint64_t> version_{0};
+
+        mutable std::mutex stateMutex_;
+        std::condition_variable stopCondition_;
+        bool stopping_ = false;
+        std::exception_ptr lastError_;
+        std::thread watcher_;
+    };
+
+    // ============================================================================
+    // Directory Functions
+    // ============================================================================
+
+    /**
+     * @brief Lazy range of the regular files in a directory that pass ListFilesSettings
+     *
+     * Entries are read from the directory one at a time as the range is iterated, so
+     * breaking out of the loop stops the scan and nothing is collected up front. The
+     * range is single-pass: every iterator shares one directory stream, and begin()
+     * resumes where the previous iteration stopped. Iterators refer to the range's
+     * settings, so the range must outlive them.
+     */
+    class DirectoryRange
+    {
+    public:
+        class iterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = std::filesystem::directory_entry;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const std::filesystem::directory_entry*;
+            using reference = const std::filesystem::directory_entry&;
+
+            iterator() = default;
+
+            reference operator*() const { return *position_; }
+            pointer operator->() const { return &*position_; }
+
+            iterator& operator++()
+            {
+                ++position_;
+                skipExcluded();
+                return *this;
+            }
+
+            bool operator==(const iterator& other) const { return position_ == other.position_; }
+            bool operator!=(const iterator& other) const { return position_ != other.position_; }
+
+        private:
+            friend class DirectoryRange;
+
+            iterator(std::filesystem::directory_iterator position, const ListFilesSettings* settings)
+                : position_(std::move(position)), settings_(settings)
+            {
+                skipExcluded();
+            }
+
+            void skipExcluded()
+            {
+                const std::filesystem::directory_iterator end;
+                while (position_ != end && !isIncluded(*position_))
+                    ++position_;
+            }
+
+            bool isIncluded(const std::filesystem::directory_entry& entry) const
+            {
+                return entry.is_regular_file() && internal::shouldIncludeFile(entry.path(), *settings_);
+            }
+
+            std::filesystem::directory_iterator position_;
+            const ListFilesSettings* settings_ = nullptr;
+        };
+
+        /**
+         * @brief Opens the directory; no entries are read until the range is iterated
+         *
+         * @param directoryPath Path to the directory
+         * @param settings Filters applied to each entry (see ListFilesSettings)
+         * @throws std::invalid_argument if directory doesn't exist
+         */
+        explicit DirectoryRange(const std::string& directoryPath, ListFilesSettings settings = {})
+            : settings_(std::move(settings))
+        {
+            if (!std::filesystem::is_directory(directoryPath))
+                throw std::invalid_argument("Directory does not exist: " + directoryPath);
+            position_ = std::filesystem::directory_iterator(directoryPath);
+        }
+
+        iterator begin() const { return iterator(position_, &settings_); }
+        iterator end() const { return iterator(); }
+
+    private:
+        std::filesystem::directory_iterator position_;
+        ListFilesSettings settings_;
+    };
+
+    /**
+     * @brief Lists all files in a directory with optional filtering
+     *
+     * @param directoryPath Path to the directory
+     * @param settingsMap Settings for filtering files (see ListFilesSettings)
+     * @return std::vector<std::string> Vector of filenames
+     * @throws std::invalid_argument if directory doesn't exist
+     */
+    inline std::vector<std::string> listFiles(
+        const std::string& directoryPath,
+        const std::unordered_map<std::string, std::string>& settingsMap = {
             {"targetFileExtensions", ""},
             {"excludeFileExtensions", ""},
             {"excludeFiles", ""}
         })
     {
-        if (!std::filesystem::exists(directoryPath) ||
-            !std::filesystem::is_directory(directoryPath))
+        internal::ScopedOperation operation(Operation::ListFiles);
+
+        std::vector<std::string> fileNames;
+        for (const auto& entry : DirectoryRange(directoryPath, ListFilesSettings::fromMap(settingsMap)))
+            fileNames.push_back(entry.path().filename().string());
+
+        return fileNames;
+    }
+
+    // ============================================================================
+    // Paginated Directory Listing
+    // ============================================================================
+
+    /**
+     * @brief Order of the entries returned by listFilesPage
+     */
+    enum class ListSortKey
+    {
+        None,           ///< Directory order; resuming skips the entries already returned
+        Name,
+        ModifiedTime,
+        Size
+    };
+
+    /**
+     * @brief One page request for listFilesPage
+     */
+    struct ListPageOptions
+    {
+        size_t limit = 1000;                    ///< Maximum entries per page
+        ListSortKey sortBy = ListSortKey::Name;
+        bool descending = false;                ///< Ignored for ListSortKey::None
+        std::string cursor;                     ///< nextCursor of the previous page; empty for the first page
+    };
+
+    /**
+     * @brief One page of file names and the cursor for the page after it
+     */
+    struct DirectoryPage
+    {
+        std::vector<std::string> fileNames;
+        std::string nextCursor;                 ///< Empty when this is the last page
+    };
+
+    namespace internal
+    {
+        /**
+         * @brief Sort position of one entry; the name breaks ties so the order is total
+         */
+        struct PageKey
+        {
+            int64_t value = 0;
+            std::string name;
+        };
+
+        class PageOrder
+        {
+        public:
+            explicit PageOrder(bool descending) : descending_(descending) {}
+
+            bool operator()(const PageKey& a, const PageKey& b) const
+            {
+                return descending_ ? ascending(b, a) : ascending(a, b);
+            }
+
+        private:
+            static bool ascending(const PageKey& a, const PageKey& b)
+            {
+                return a.value != b.value ? a.value < b.value : a.name < b.name;
+            }
+
+            bool descending_;
+        };
+
+        /**
+         * @brief Cursor prefix identifying sort key and direction, so a cursor can't be reused with other options
+         */
+        inline std::string cursorPrefix(const ListPageOptions& options)
+        {
+            static const char keys[] = {'o', 'n', 'm', 's'};
+            std::string prefix(1, keys[static_cast<size_t>(options.sortBy)]);
+            if (options.sortBy != ListSortKey::None)
+                prefix += options.descending ? '-' : '+';
+            return prefix + ':';
+        }
+
+        /**
+         * @brief Hex-encodes a file name so cursors are plain ASCII and safe to put in URLs
+         */
+        inline std::string encodeCursorName(const std::string& name)
+        {
+            static const char hexDigits[] = "0123456789abcdef";
+            std::string out;
+            out.reserve(name.size() * 2);
+            for (unsigned char byte : name)
+            {
+                out += hexDigits[byte >> 4];
+                out += hexDigits[byte & 0xf];
+            }
+            return out;
+        }
+
+        inline int hexValue(char c)
+        {
+            if (c >= '0' && c <= '9')
+                return c - '0';
+            if (c >= 'a' && c <= 'f')
+                return c - 'a' + 10;
+            return -1;
+        }
+
+        inline std::string encodeCursor(const ListPageOptions& options, const PageKey& last)
+        {
+            return cursorPrefix(options) + std::to_string(last.value) + ':' + encodeCursorName(last.name);
+        }
+
+        /**
+         * @brief Parses a cursor made by encodeCursor for the same options
+         *
+         * @throws std::invalid_argument if the cursor is malformed or was made with other options
+         */
+        inline PageKey decodeCursor(const ListPageOptions& options)
+        {
+            const std::string prefix = cursorPrefix(options);
+            const std::string& cursor = options.cursor;
+            const size_t separator = cursor.find(':', prefix.size());
+            if (!startsWith(cursor, prefix) || separator == std::string::npos || (cursor.size() - separator) % 2 == 0)
+                throw std::invalid_argument("Invalid or mismatched directory cursor: " + cursor);
+
+            PageKey key;
+            const char* numberEnd = cursor.data() + separator;
+            auto parsed = std::from_chars(cursor.data() + prefix.size(), numberEnd, key.value);
+            if (parsed.ec != std::errc() || parsed.ptr != numberEnd)
+                throw std::invalid_argument("Invalid or mismatched directory cursor: " + cursor);
+
+            for (size_t i = separator + 1; i < cursor.size(); i += 2)
+            {
+                int high = hexValue(cursor[i]);
+                int low = hexValue(cursor[i + 1]);
+                if (high < 0 || low < 0)
+                    throw std::invalid_argument("Invalid or mismatched directory cursor: " + cursor);
+                key.name += static_cast<char>(high * 16 + low);
+            }
+            return key;
+        }
+
+        /**
+         * @brief Reads an entry's sort value; false if the entry vanished or can't be stat'ed
+         */
+        inline bool readSortValue(const std::filesystem::directory_entry& entry, ListSortKey sortBy, int64_t& value)
+        {
+            std::error_code error;
+            if (sortBy == ListSortKey::Size)
+                value = static_cast<int64_t>(entry.file_size(error));
+            else if (sortBy == ListSortKey::ModifiedTime)
+                value = static_cast<int64_t>(entry.last_write_time(error).time_since_epoch().count());
+            else
+                value = 0;
+            return !error;
+        }
+
+        inline DirectoryPage listUnsortedPage(DirectoryRange& range, const ListPageOptions& options)
+        {
+            const int64_t offset = options.cursor.empty() ? 0 : decodeCursor(options).value;
+            if (offset < 0)
+                throw std::invalid_argument("Invalid or mismatched directory cursor: " + options.cursor);
+
+            DirectoryPage page;
+            auto entry = range.begin();
+            for (int64_t skipped = 0; entry != range.end() && skipped < offset; ++entry)
+                ++skipped;
+            for (; entry != range.end() && page.fileNames.size() < options.limit; ++entry)
+                page.fileNames.push_back(entry->path().filename().string());
+
+            if (entry != range.end())
+                page.nextCursor = encodeCursor(options, {offset + static_cast<int64_t>(page.fileNames.size()), ""});
+            return page;
+        }
+
+        /**
+         * @brief Keeps the `limit + 1` smallest keys after the cursor in a bounded max-heap
+         *
+         * Memory stays proportional to the page size however large the directory is; the
+         * extra entry only tells whether another page follows.
+         */
+        inline DirectoryPage listSortedPage(DirectoryRange& range, const ListPageOptions& options)
+        {
+            const PageOrder before(options.descending);
+            const bool resuming = !options.cursor.empty();
+            const PageKey cursor = resuming ? decodeCursor(options) : PageKey();
+            const size_t capacity = std::min(options.limit, std::numeric_limits<size_t>::max() - 1) + 1;
+
+            std::vector<PageKey> heap;
+            heap.reserve(std::min<size_t>(capacity, 4096));
+            for (const auto& entry : range)
+            {
+                PageKey key;
+                if (!readSortValue(entry, options.sortBy, key.value))
+                    continue;
+                key.name = entry.path().filename().string();
+                if (resuming && !before(cursor, key))
+                    continue;
+                if (heap.size() == capacity && !before(key, heap.front()))
+                    continue;
+
+                heap.push_back(std::move(key));
+                std::push_heap(heap.begin(), heap.end(), before);
+                if (heap.size() <= capacity)
+                    continue;
+                std::pop_heap(heap.begin(), heap.end(), before);
+                heap.pop_back();
+            }
+
+            std::sort_heap(heap.begin(), heap.end(), before);
+            DirectoryPage page;
+            if (heap.size() == capacity)
+            {
+                heap.pop_back();
+                page.nextCursor = encodeCursor(options, heap.back());
+            }
+            page.fileNames.reserve(heap.size());
+            for (PageKey& key : heap)
+                page.fileNames.push_back(std::move(key.name));
+            return page;
+        }
+    }
+
+    /**
+     * @brief Lists one page of a directory, optionally sorted, in memory bounded by the page size
+     *
+     * Pass each page's nextCursor back in ListPageOptions::cursor to get the next page.
+     * Sorted pages scan the whole directory but keep only the best `limit + 1` entries
+     * in a heap, so memory per call is O(limit) rather than O(directory size). The cursor
+     * holds the sort key of the last entry returned, so files added or removed between
+     * calls don't cause repeats or skips. Unsorted pages resume by counting entries,
+     * which is only stable while the directory is unchanged. Files that vanish during
+     * the scan are skipped.
+     *
+     * @param directoryPath Path to the directory
+     * @param options Page size, sort order and cursor (see ListPageOptions)
+     * @param settingsMap Settings for filtering files (see ListFilesSettings)
+     * @return DirectoryPage File names for this page and the cursor for the next one
+     * @throws std::invalid_argument if directory doesn't exist, limit is 0, or the cursor
+     *         is malformed or was produced with a different sort key or direction
+     */
+    inline DirectoryPage listFilesPage(
+        const std::string& directoryPath,
+        const ListPageOptions& options = {},
+        const std::unordered_map<std::string, std::string>& settingsMap = {})
+    {
+        internal::ScopedOperation operation(Operation::ListFiles);
+
+        if (options.limit == 0)
+            throw std::invalid_argument("Page limit must be greater than zero");
+
+        DirectoryRange range(directoryPath, ListFilesSettings::fromMap(settingsMap));
+        if (options.sortBy == ListSortKey::None)
+            return internal::listUnsortedPage(range, options);
+        return internal::listSortedPage(range, options);
+    }
+
+    // ============================================================================
+    // Executors
+    // ============================================================================
+
+    namespace internal
+    {
+        inline size_t resolveThreadCount(size_t requested, size_t taskCount)
+        {
+            size_t threads = requested != 0 ? requested : std::thread::hardware_concurrency();
+            return std::max<size_t>(1, std::min(threads, taskCount));
+        }
+    }
+
+    /**
+     * @brief Interface for running the library's parallel work
+     *
+     * Implement it to route library tasks onto an application-owned pool; install it
+     * with setDefaultExecutor or pass it to individual operations.
+     */
+    class Executor
+    {
+    public:
+        virtual ~Executor() = default;
+
+        /**
+         * @brief Schedules task to run once; must not block waiting for it
+         *
+         * The library's own tasks never throw; they capture errors and hand them back to
+         * the caller. ThreadPool discards any exception that escapes a task.
+         */
+        virtual void submit(std::function<void()> task) = 0;
+
+        /**
+         * @brief Number of tasks this executor can run at the same time
+         */
+        virtual size_t concurrency() const = 0;
+    };
+
+    /**
+     * @brief Fixed-size work-stealing thread pool
+     *
+     * Each worker owns a deque: tasks submitted from a worker go to the back of its own
+     * deque and are popped LIFO for locality, idle workers steal from the front of other
+     * workers' deques, and tasks submitted from outside are spread round-robin. Queued
+     * tasks are drained before the destructor returns. The pool may also be destroyed by
+     * one of its own tasks (for example, a task releasing the last shared_ptr to it);
+     * that worker is then detached and finishes the queue after the destructor returns.
+     */
+    class ThreadPool : public Executor
+    {
+    public:
+        /**
+         * @param threadCount Number of worker threads; 0 uses the hardware concurrency
+         */
+        explicit ThreadPool(size_t threadCount = 0) : shared_(std::make_shared<Shared>())
+        {
+            threadCount = internal::resolveThreadCount(threadCount, std::numeric_limits<size_t>::max());
+            for (size_t i = 0; i < threadCount; ++i)
+                shared_->queues.push_back(std::make_unique<WorkQueue>());
+            for (size_t i = 0; i < threadCount; ++i)
+                workers_.emplace_back([shared = shared_, i] { shared->runWorker(i); });
+        }
+
+        ~ThreadPool() override
+        {
+            {
+                std::lock_guard<std::mutex> lock(shared_->sleepMutex);
+                shared_->stopping = true;
+            }
+            shared_->wakeCondition.notify_all();
+            for (auto& worker : workers_)
+            {
+                if (worker.get_id() == std::this_thread::get_id())
+                    worker.detach();
+                else
+                    worker.join();
+            }
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        void submit(std::function<void()> task) override
+        {
+            shared_->submit(std::move(task));
+        }
+
+        size_t concurrency() const override { return workers_.size(); }
+
+    private:
+        struct WorkQueue
+        {
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        /**
+         * @brief Queues and wake-up state, owned jointly by the pool and its workers
+         */
+        struct Shared
+        {
+            void submit(std::function<void()> task)
+            {
+                size_t queue = currentPool_ == this ? currentWorker_ : nextQueue++ % queues.size();
+                {
+                    // Counted under the same lock that runTask decrements under, so a worker that
+                    // steals the task before this returns can't drive pendingTasks below zero
+                    std::lock_guard<std::mutex> sleepLock(sleepMutex);
+                    {
+                        std::lock_guard<std::mutex> queueLock(queues[queue]->mutex);
+                        queues[queue]->tasks.push_back(std::move(task));
+                    }
+                    ++pendingTasks;
+                }
+                wakeCondition.notify_one();
+            }
+
+            void runWorker(size_t index)
+            {
+                currentPool_ = this;
+                currentWorker_ = index;
+
+                std::function<void()> task;
+                while (waitForTask())
+                {
+                    if (popOwn(index, task) || steal(index, task))
+                        runTask(task);
+                }
+            }
+
+            /**
+             * @brief Sleeps until a task is pending; false once stopping with nothing left to run
+             */
+            bool waitForTask()
+            {
+                std::unique_lock<std::mutex> lock(sleepMutex);
+                wakeCondition.wait(lock, [this] { return pendingTasks > 0 || stopping; });
+                return pendingTasks > 0;
+            }
+
+            void runTask(std::function<void()>& task)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(sleepMutex);
+                    --pendingTasks;
+                }
+                try
+                {
+                    task();
+                }
+                catch (...)
+                {
+                    // An exception escaping a worker would call std::terminate
+                }
+                task = nullptr;
+            }
+
+            bool popOwn(size_t index, std::function<void()>& task)
+            {
+                WorkQueue& queue = *queues[index];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (queue.tasks.empty())
+                    return false;
+
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+                return true;
+            }
+
+            bool steal(size_t thief, std::function<void()>& task)
+            {
+                for (size_t offset = 1; offset < queues.size(); ++offset)
+                {
+                    if (stealFrom((thief + offset) % queues.size(), task))
+                        return true;
+                }
+                return false;
+            }
+
+            bool stealFrom(size_t victim, std::function<void()>& task)
+            {
+                WorkQueue& queue = *queues[victim];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (queue.tasks.empty())
+                    return false;
+
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+                return true;
+            }
+
+            std::vector<std::unique_ptr<WorkQueue>> queues;
+            std::atomic<size_t> nextQueue{0};
+
+            std::mutex sleepMutex;
+            std::condition_variable wakeCondition;
+            size_t pendingTasks = 0;
+            bool stopping = false;
+        };
+
+        static inline thread_local Shared* currentPool_ = nullptr;
+        static inline thread_local size_t currentWorker_ = 0;
+
+        std::shared_ptr<Shared> shared_;
+        std::vector<std::thread> workers_;
+    };
+
+    namespace internal
+    {
+        struct DefaultExecutorSlot
+        {
+            std::mutex mutex;
+            std::shared_ptr<Executor> executor;
+        };
+
+        inline DefaultExecutorSlot& defaultExecutorSlot()
         {
-            throw std::invalid_argument("Directory does not exist: " + directoryPath);
+            static DefaultExecutorSlot slot;
+            return slot;
         }
+    }
 
-        ListFilesSettings settings = ListFilesSettings::fromMap(settingsMap);
-        std::vector<std::string> fileNames;
+    /**
+     * @brief Replaces the executor used by parallel operations when none is passed explicitly
+     *
+     * Pass nullptr to go back to the built-in pool. Operations already running keep the
+     * executor they started with.
+     */
+    inline void setDefaultExecutor(std::shared_ptr<Executor> executor)
+    {
+        auto& slot = internal::defaultExecutorSlot();
+        std::lock_guard<std::mutex> lock(slot.mutex);
+        slot.executor = std::move(executor);
+    }
+
+    /**
+     * @brief The executor used by parallel operations, creating a hardware-sized ThreadPool on first use
+     */
+    inline std::shared_ptr<Executor> defaultExecutor()
+    {
+        auto& slot = internal::defaultExecutorSlot();
+        std::lock_guard<std::mutex> lock(slot.mutex);
+        if (!slot.executor)
+            slot.executor = std::make_shared<ThreadPool>();
+        return slot.executor;
+    }
 
-        for (const auto& entry : std::filesystem::directory_iterator(directoryPath))
+    namespace internal
+    {
+        /**
+         * @brief Shared between parallelFor and its helper tasks, which may start after it returns
+         */
+        struct ParallelForState
         {
-            if (!entry.is_regular_file())
-                continue;
+            explicit ParallelForState(size_t taskCount) : count(taskCount) {}
+
+            const size_t count;
+            std::atomic<size_t> nextIndex{0};
+            std::atomic<bool> failed{false};
+
+            std::mutex mutex;
+            std::condition_variable helpersDone;
+            size_t activeHelpers = 0;
+            bool closed = false;
+            std::exception_ptr firstError;
+        };
 
-            if (internal::shouldIncludeFile(entry.path(), settings))
-                fileNames.push_back(entry.path().filename().string());
+        template<typename Task>
+        void runParallelForLoop(ParallelForState& state, const Task& task)
+        {
+            for (size_t index = state.nextIndex++; index < state.count && !state.failed; index = state.nextIndex++)
+            {
+                try
+                {
+                    task(index);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(state.mutex);
+                    if (!state.failed.exchange(true))
+                        state.firstError = std::current_exception();
+                }
+            }
         }
 
-        return fileNames;
+        template<typename Task>
+        void runParallelForHelper(const std::shared_ptr<ParallelForState>& state, const Task& task)
+        {
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                if (state->closed)
+                    return;
+                ++state->activeHelpers;
+            }
+
+            runParallelForLoop(*state, task);
+
+            std::lock_guard<std::mutex> lock(state->mutex);
+            --state->activeHelpers;
+            state->helpersDone.notify_all();
+        }
+
+        /**
+         * @brief Runs task(i) for every i in [0, count) on the executor, with at most maxParallelism tasks at once
+         *
+         * Indices are claimed dynamically and the calling thread participates, so the loop
+         * always completes even when every executor thread is busy (including when called
+         * from inside an executor task). Helpers that have not started by the time the
+         * caller finishes are skipped. The first exception thrown by any task is rethrown.
+         */
+        template<typename Task>
+        void parallelFor(size_t count, size_t maxParallelism, const Task& task, Executor& executor)
+        {
+            auto state = std::make_shared<ParallelForState>(count);
+            size_t helpers = resolveThreadCount(std::min(maxParallelism == 0 ? executor.concurrency() : maxParallelism,
+                                                         executor.concurrency() + 1), count) - 1;
+
+            for (size_t i = 0; i < helpers; ++i)
+                executor.submit([state, &task] { runParallelForHelper(state, task); });
+
+            runParallelForLoop(*state, task);
+
+            std::unique_lock<std::mutex> lock(state->mutex);
+            state->closed = true;
+            state->helpersDone.wait(lock, [&state] { return state->activeHelpers == 0; });
+
+            if (state->firstError)
+                std::rethrow_exception(state->firstError);
+        }
+    }
+
+    // ============================================================================
+    // Parallel Directory Loading
+    // ============================================================================
+
+    /**
+     * @brief One file's result from loadDirectory
+     */
+    struct LoadedFile
+    {
+        std::string fileName;
+        std::vector<std::string> lines;
+    };
+
+    /**
+     * @brief Lists a directory and loads every matching file concurrently
+     *
+     * Equivalent to calling loadFileIntoVector on each file returned by listFiles, but
+     * the files are loaded on an Executor. Results are sorted by file name, so the
+     * output is deterministic regardless of directory order or scheduling.
+     *
+     * @param directoryPath Path to the directory
+     * @param listSettingsMap Settings for filtering files (see ListFilesSettings)
+     * @param loadSettingsMap Settings for filtering lines (see LoadSettings)
+     * @param threadCount Maximum number of files loaded at once; 0 uses the executor's concurrency
+     * @param separator Character used to separate lines
+     * @param skipEmptyLines If true, skip empty lines
+     * @param readOptions Buffer size and kernel hints (see ReadOptions)
+     * @param executor Executor to load on; nullptr uses defaultExecutor()
+     * @return std::vector<LoadedFile> One entry per file, ordered by file name
+     * @throws std::invalid_argument if directory doesn't exist or a file cannot be opened
+     */
+    inline std::vector<LoadedFile> loadDirectory(
+        const std::string& directoryPath,
+        const std::unordered_map<std::string, std::string>& listSettingsMap = {},
+        const std::unordered_map<std::string, std::vector<std::string>>& loadSettingsMap = {},
+        size_t threadCount = 0,
+        char separator = '\n',
+        bool skipEmptyLines = true,
+        const ReadOptions& readOptions = {},
+        const std::shared_ptr<Executor>& executor = nullptr)
+    {
+        internal::ScopedOperation operation(Operation::LoadDirectory);
+        std::vector<std::string> fileNames = listFiles(directoryPath, listSettingsMap);
+        std::sort(fileNames.begin(), fileNames.end());
+
+        LoadSettings settings(loadSettingsMap, separator, skipEmptyLines);
+        const std::filesystem::path directory(directoryPath);
+        std::vector<LoadedFile> files(fileNames.size());
+
+        auto loadFile = [&](size_t index)
+        {
+            internal::IoAttribution attribution(operation.io());
+            files[index].fileName = std::move(fileNames[index]);
+            files[index].lines = internal::loadLines((directory / files[index].fileName).string(),
+                                                     settings, readOptions);
+        };
+
+        internal::parallelFor(fileNames.size(), threadCount, loadFile,
+                              executor ? *executor : *defaultExecutor());
+
+        for (const LoadedFile& file : files)
+            operation.addLines(file.lines.size());
+        return files;
+    }
+
+    // ============================================================================
+    // Asynchronous File Operations
+    // ============================================================================
+
+    namespace internal
+    {
+        /**
+         * @brief Runs function on the executor (or defaultExecutor()) and returns a future for its result
+         *
+         * Exceptions thrown by function are delivered through the future.
+         */
+        template<typename Function>
+        auto submitAsync(const std::shared_ptr<Executor>& executor, Function&& function)
+            -> std::future<std::invoke_result_t<std::decay_t<Function>>>
+        {
+            using Result = std::invoke_result_t<std::decay_t<Function>>;
+            auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Function>(function));
+            std::future<Result> future = task->get_future();
+
+            std::shared_ptr<Executor> target = executor ? executor : defaultExecutor();
+            target->submit([task] { (*task)(); });
+            return future;
+        }
+    }
+
+    /**
+     * @brief Asynchronous loadFileIntoVector; arguments are copied into the task
+     *
+     * @param executor Executor to run on; nullptr uses defaultExecutor()
+     * @return std::future<std::vector<std::string>> Becomes ready with the lines or the thrown exception
+     */
+    inline std::future<std::vector<std::string>> loadFileIntoVectorAsync(
+        std::string filePath,
+        std::unordered_map<std::string, std::vector<std::string>> settingsMap = {},
+        char separator = '\n',
+        bool skipEmptyLines = true,
+        ReadOptions readOptions = {},
+        const std::shared_ptr<Executor>& executor = nullptr)
+    {
+        return internal::submitAsync(executor, [=]
+        {
+            return loadFileIntoVector(filePath, settingsMap, separator, skipEmptyLines, readOptions);
+        });
+    }
+
+    /**
+     * @brief Asynchronous loadFileIntoVectorOfInts; arguments are copied into the task
+     *
+     * @param executor Executor to run on; nullptr uses defaultExecutor()
+     * @return std::future<std::vector<int>> Becomes ready with the integers or the thrown exception
+     */
+    inline std::future<std::vector<int>> loadFileIntoVectorOfIntsAsync(
+        std::string filePath,
+        ReadOptions readOptions = {},
+        const std::shared_ptr<Executor>& executor = nullptr)
+    {
+        return internal::submitAsync(executor, [=]
+        {
+            return loadFileIntoVectorOfInts(filePath, {}, '\n', true, readOptions);
+        });
+    }
+
+    /**
+     * @brief Asynchronous getRandomFileLine; arguments are copied into the task
+     *
+     * @param executor Executor to run on; nullptr uses defaultExecutor()
+     * @return std::future<std::string> Becomes ready with the line or the thrown exception
+     */
+    inline std::future<std::string> getRandomFileLineAsync(
+        std::string filePath,
+        char separator = '\n',
+        ReadOptions readOptions = {},
+        const std::shared_ptr<Executor>& executor = nullptr)
+    {
+        return internal::submitAsync(executor, [=]
+        {
+            return getRandomFileLine(filePath, separator, readOptions);
+        });
+    }
+
+    /**
+     * @brief Asynchronous appendToFile; arguments are copied into the task
+     *
+     * Appends submitted concurrently to the same file may complete in any order.
+     *
+     * @param executor Executor to run on; nullptr uses defaultExecutor()
+     * @return std::future<void> Becomes ready when the content is written, or with the thrown exception
+     */
+    template<typename ContentType>
+    std::future<void> appendToFileAsync(std::string filePath, ContentType content,
+                                        bool createIfNonExistent = true,
+                                        const std::shared_ptr<Executor>& executor = nullptr)
+    {
+        return internal::submitAsync(executor, [filePath = std::move(filePath), content = std::move(content),
+                                                createIfNonExistent]
+        {
+            appendToFile(filePath, content, createIfNonExistent);
+        });
+    }
+
+    /**
+     * @brief Asynchronous writeFileAtomic; the content is copied into the task
+     *
+     * @param executor Executor to run on; nullptr uses defaultExecutor()
+     * @return std::future<void> Becomes ready once the file is replaced, or with the thrown exception
+     */
+    inline std::future<void> writeFileAtomicAsync(std::string filePath, std::string content,
+                                                  AtomicWriteSettings settings = {},
+                                                  const std::shared_ptr<Executor>& executor = nullptr)
+    {
+        return internal::submitAsync(executor, [filePath = std::move(filePath), content = std::move(content), settings]
+        {
+            writeFileAtomic(filePath, content, settings);
+        });
+    }
+
+    /**
+     * @brief Asynchronous writeLinesToFile; the lines are moved or copied into the task
+     *
+     * @param executor Executor to run on; nullptr uses defaultExecutor()
+     * @return std::future<void> Becomes ready once the lines are written, or with the thrown exception
+     */
+    inline std::future<void> writeLinesToFileAsync(std::string filePath, std::vector<std::string> lines,
+                                                   char separator = '\n', WriteMode mode = WriteMode::Truncate,
+                                                   const std::shared_ptr<Executor>& executor = nullptr)
+    {
+        return internal::submitAsync(executor, [filePath = std::move(filePath), lines = std::move(lines), separator, mode]
+        {
+            writeLinesToFile(filePath, lines, separator, mode);
+        });
+    }
+
+    /**
+     * @brief Asynchronous listFiles; arguments are copied into the task
+     *
+     * @param executor Executor to run on; nullptr uses defaultExecutor()
+     * @return std::future<std::vector<std::string>> Becomes ready with the file names or the thrown exception
+     */
+    inline std::future<std::vector<std::string>> listFilesAsync(
+        std::string directoryPath,
+        std::unordered_map<std::string, std::string> settingsMap = {},
+        const std::shared_ptr<Executor>& executor = nullptr)
+    {
+        return internal::submitAsync(executor, [=]
+        {
+            return listFiles(directoryPath, settingsMap);
+        });
+    }
+
+    /**
+     * @brief Asynchronous loadDirectory; the per-file loads run on the same executor
+     *
+     * @param executor Executor to run on; nullptr uses defaultExecutor()
+     * @return std::future<std::vector<LoadedFile>> Becomes ready with the loaded files or the thrown exception
+     */
+    inline std::future<std::vector<LoadedFile>> loadDirectoryAsync(
+        std::string directoryPath,
+        std::unordered_map<std::string, std::string> listSettingsMap = {},
+        std::unordered_map<std::string, std::vector<std::string>> loadSettingsMap = {},
+        size_t threadCount = 0,
+        char separator = '\n',
+        bool skipEmptyLines = true,
+        ReadOptions readOptions = {},
+        const std::shared_ptr<Executor>& executor = nullptr)
+    {
+        return internal::submitAsync(executor, [=]
+        {
+            return loadDirectory(directoryPath, listSettingsMap, loadSettingsMap, threadCount,
+                                 separator, skipEmptyLines, readOptions, executor);
+        });
+    }
+
+#if STEVENS_FILE_LIB_COROUTINES
+    // ============================================================================
+    // Coroutine Line Streaming (C++20)
+    // ============================================================================
+
+    /**
+     * @brief Lazily evaluated range of lines produced by a coroutine
+     *
+     * The coroutine runs only as the range is iterated. Each line is a view that stays
+     * valid until the iterator is advanced. Exceptions thrown while reading (including
+     * failing to open the file) are rethrown from begin() or operator++.
+     */
+    class LineGenerator
+    {
+    public:
+        struct promise_type
+        {
+            const std::string_view* current = nullptr;
+            std::exception_ptr error;
+
+            LineGenerator get_return_object()
+            {
+                return LineGenerator(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            std::suspend_always final_suspend() noexcept { return {}; }
+
+            std::suspend_always yield_value(const std::string_view& line) noexcept
+            {
+                current = &line;
+                return {};
+            }
+
+            void return_void() noexcept {}
+            void unhandled_exception() { error = std::current_exception(); }
+        };
+
+        using Handle = std::coroutine_handle<promise_type>;
+
+        class iterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() = default;
+            explicit iterator(Handle coroutine) : coroutine_(coroutine) {}
+
+            std::string_view operator*() const { return *coroutine_.promise().current; }
+
+            iterator& operator++()
+            {
+                resume(coroutine_);
+                return *this;
+            }
+
+            void operator++(int) { ++*this; }
+
+            bool operator==(std::default_sentinel_t) const { return !coroutine_ || coroutine_.done(); }
+
+        private:
+            Handle coroutine_;
+        };
+
+        explicit LineGenerator(Handle coroutine) : coroutine_(coroutine) {}
+
+        LineGenerator(LineGenerator&& other) noexcept : coroutine_(std::exchange(other.coroutine_, {})) {}
+
+        LineGenerator& operator=(LineGenerator&& other) noexcept
+        {
+            if (this != &other)
+            {
+                destroy();
+                coroutine_ = std::exchange(other.coroutine_, {});
+            }
+            return *this;
+        }
+
+        ~LineGenerator() { destroy(); }
+
+        iterator begin()
+        {
+            resume(coroutine_);
+            return iterator(coroutine_);
+        }
+
+        std::default_sentinel_t end() const { return {}; }
+
+    private:
+        static void resume(Handle coroutine)
+        {
+            coroutine.resume();
+            if (coroutine.promise().error)
+                std::rethrow_exception(std::exchange(coroutine.promise().error, nullptr));
+        }
+
+        void destroy()
+        {
+            if (coroutine_)
+                coroutine_.destroy();
+        }
+
+        Handle coroutine_;
+    };
+
+    /**
+     * @brief Streams a file's filtered lines through a coroutine generator
+     *
+     * Nothing is read until the returned range is iterated.
+     *
+     * @param filePath Path to the file
+     * @param settings Line filtering (see LoadSettings)
+     * @param readOptions Buffer size and kernel hints (see ReadOptions)
+     * @return LineGenerator Input range of std::string_view lines
+     */
+    inline LineGenerator streamLines(std::string filePath, LoadSettings settings = {},
+                                     ReadOptions readOptions = {})
+    {
+        LineReader reader(filePath, std::move(settings), readOptions);
+        std::string_view line;
+        while (reader.next(line))
+            co_yield line;
     }
 
+    /**
+     * @brief Reads lines from inside a coroutine, suspending while each read runs on an Executor
+     *
+     * `co_await reader.next()` suspends the calling coroutine, performs the read on the
+     * executor and resumes the coroutine on that executor's thread. The file is opened by
+     * the first read, so construction never blocks. Only one next() may be pending at a time.
+     */
+    class AsyncLineReader
+    {
+    public:
+        class NextLine
+        {
+        public:
+            explicit NextLine(AsyncLineReader& reader) : reader_(reader) {}
+
+            bool await_ready() const noexcept { return false; }
+
+            void await_suspend(std::coroutine_handle<> coroutine)
+            {
+                // The resumed coroutine may destroy the reader, and with it the last other
+                // reference to the executor, before submit() returns or while the task runs
+                AsyncLineReader& reader = reader_;
+                std::shared_ptr<Executor> executor = reader.executor_;
+                executor->submit([&reader, coroutine, executor]
+                {
+                    reader.readNext();
+                    coroutine.resume();
+                });
+            }
+
+            /**
+             * @return The next line, valid until the following next(); std::nullopt at end of file
+             * @throws Any exception raised by opening or reading the file
+             */
+            std::optional<std::string_view> await_resume()
+            {
+                if (reader_.error_)
+                    std::rethrow_exception(std::exchange(reader_.error_, nullptr));
+                if (!reader_.hasLine_)
+                    return std::nullopt;
+                return reader_.line_;
+            }
+
+        private:
+            AsyncLineReader& reader_;
+        };
+
+        /**
+         * @param executor Executor that performs the reads; nullptr uses defaultExecutor()
+         */
+        explicit AsyncLineReader(std::string filePath, LoadSettings settings = {}, ReadOptions readOptions = {},
+                                 std::shared_ptr<Executor> executor = nullptr)
+            : filePath_(std::move(filePath)), settings_(std::move(settings)), readOptions_(readOptions),
+              executor_(executor ? std::move(executor) : defaultExecutor())
+        {
+        }
+
+        AsyncLineReader(const AsyncLineReader&) = delete;
+        AsyncLineReader& operator=(const AsyncLineReader&) = delete;
+
+        NextLine next() { return NextLine(*this); }
+
+    private:
+        void readNext()
+        {
+            try
+            {
+                if (!reader_)
+                    reader_.emplace(filePath_, settings_, readOptions_);
+                hasLine_ = reader_->next(line_);
+            }
+            catch (...)
+            {
+                error_ = std::current_exception();
+            }
+        }
+
+        std::string filePath_;
+        LoadSettings settings_;
+        ReadOptions readOptions_;
+        std::shared_ptr<Executor> executor_;
+        std::optional<LineReader> reader_;
+        std::string_view line_;
+        bool hasLine_ = false;
+        std::exception_ptr error_;
+    };
+#endif
+
 } // namespace stevensFileLib
 
 #endif // STEVENS_FILE_LIB_HPP
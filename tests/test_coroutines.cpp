@@ -0,0 +1,184 @@
+#include "stevensFileLib.hpp"
+#include <gtest/gtest.h>
+#include <coroutine>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    /**
+     * @brief Minimal eagerly started coroutine that reports completion through a future
+     */
+    struct Task
+    {
+        struct promise_type
+        {
+            std::promise<void> done;
+
+            Task get_return_object() { return Task{done.get_future()}; }
+            std::suspend_never initial_suspend() noexcept { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() { done.set_value(); }
+            void unhandled_exception() { done.set_exception(std::current_exception()); }
+        };
+
+        std::future<void> finished;
+    };
+
+    /**
+     * @brief Reads a file through a reader that holds the only reference to its pool
+     */
+    Task collectLinesWithOwnPool(std::string path, std::vector<std::string>& lines,
+                                 std::weak_ptr<stevensFileLib::ThreadPool>& poolObserver)
+    {
+        auto pool = std::make_shared<stevensFileLib::ThreadPool>(2);
+        poolObserver = pool;
+        stevensFileLib::AsyncLineReader reader(std::move(path), {}, {}, std::move(pool));
+
+        while (auto line = co_await reader.next())
+            lines.emplace_back(*line);
+    }
+
+    Task collectLines(stevensFileLib::AsyncLineReader& reader, std::vector<std::string>& lines,
+                      std::vector<std::thread::id>& resumedOn)
+    {
+        while (auto line = co_await reader.next())
+        {
+            lines.emplace_back(*line);
+            resumedOn.push_back(std::this_thread::get_id());
+        }
+    }
+}
+
+class CoroutineTest : public ::testing::Test
+{
+protected:
+    const std::string testDir = "test_files_coroutines";
+    const std::string testFile = testDir + "/test.txt";
+
+    void SetUp() override
+    {
+        fs::create_directories(testDir);
+    }
+
+    void TearDown() override
+    {
+        if (fs::exists(testDir))
+            fs::remove_all(testDir);
+    }
+
+    void createTestFile(const std::string& path, const std::string& content)
+    {
+        std::ofstream file(path);
+        file << content;
+    }
+};
+
+// ============================================================================
+// Tests for streamLines
+// ============================================================================
+
+TEST_F(CoroutineTest, StreamLines_SmallBuffer_YieldsEveryLine)
+{
+    std::vector<std::string> expected;
+    for (int i = 0; i < 2000; ++i)
+        expected.push_back("line " + std::to_string(i));
+    stevensFileLib::writeLinesToFile(testFile, expected);
+
+    stevensFileLib::ReadOptions options;
+    options.bufferSize = 4096;
+
+    std::vector<std::string> lines;
+    for (std::string_view line : stevensFileLib::streamLines(testFile, {}, options))
+        lines.emplace_back(line);
+
+    EXPECT_EQ(lines, expected);
+}
+
+TEST_F(CoroutineTest, StreamLines_WithFilters_SkipsFilteredLines)
+{
+    createTestFile(testFile, "# header\nalpha\n\nbeta\n");
+
+    stevensFileLib::LoadSettings settings;
+    settings.skipIfStartsWith = {"#"};
+
+    std::vector<std::string> lines;
+    for (std::string_view line : stevensFileLib::streamLines(testFile, settings))
+        lines.emplace_back(line);
+
+    EXPECT_EQ(lines, (std::vector<std::string>{"alpha", "beta"}));
+}
+
+TEST_F(CoroutineTest, StreamLines_FileDoesNotExist_ThrowsWhenIterated)
+{
+    auto lines = stevensFileLib::streamLines(testDir + "/missing.txt");
+
+    EXPECT_THROW(lines.begin(), std::invalid_argument);
+}
+
+TEST_F(CoroutineTest, StreamLines_StopEarly_ReleasesFile)
+{
+    createTestFile(testFile, "one\ntwo\nthree\n");
+
+    std::string first;
+    for (std::string_view line : stevensFileLib::streamLines(testFile))
+    {
+        first = line;
+        break;
+    }
+
+    EXPECT_EQ(first, "one");
+}
+
+// ============================================================================
+// Tests for AsyncLineReader
+// ============================================================================
+
+TEST_F(CoroutineTest, AsyncLineReader_ReadsAllLinesOnExecutorThreads)
+{
+    createTestFile(testFile, "one\ntwo\n\nthree");
+    auto pool = std::make_shared<stevensFileLib::ThreadPool>(2);
+    stevensFileLib::AsyncLineReader reader(testFile, {}, {}, pool);
+
+    std::vector<std::string> lines;
+    std::vector<std::thread::id> resumedOn;
+    Task task = collectLines(reader, lines, resumedOn);
+    task.finished.get();
+
+    EXPECT_EQ(lines, (std::vector<std::string>{"one", "two", "three"}));
+    for (std::thread::id id : resumedOn)
+        EXPECT_NE(id, std::this_thread::get_id());
+}
+
+TEST_F(CoroutineTest, AsyncLineReader_OwnsOnlyPoolReference_PoolDestroyedOnItsWorker)
+{
+    createTestFile(testFile, "one\ntwo\nthree\n");
+
+    std::vector<std::string> lines;
+    std::weak_ptr<stevensFileLib::ThreadPool> poolObserver;
+    Task task = collectLinesWithOwnPool(testFile, lines, poolObserver);
+    task.finished.get();
+
+    // The coroutine finishes on a pool worker, which then releases the last reference
+    for (int i = 0; i < 500 && !poolObserver.expired(); ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    EXPECT_EQ(lines, (std::vector<std::string>{"one", "two", "three"}));
+    EXPECT_TRUE(poolObserver.expired());
+}
+
+TEST_F(CoroutineTest, AsyncLineReader_FileDoesNotExist_RethrowsInCoroutine)
+{
+    auto pool = std::make_shared<stevensFileLib::ThreadPool>(1);
+    stevensFileLib::AsyncLineReader reader(testDir + "/missing.txt", {}, {}, pool);
+
+    std::vector<std::string> lines;
+    std::vector<std::thread::id> resumedOn;
+    Task task = collectLines(reader, lines, resumedOn);
+
+    EXPECT_THROW(task.finished.get(), std::invalid_argument);
+}
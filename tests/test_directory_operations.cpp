@@ -235,3 +235,281 @@ TEST_F(DirectoryOperationsTest, ListFiles_FileWithNoExtension_HandledCorrectly)
     ASSERT_EQ(files.size(), 1);
     EXPECT_EQ(files[0], "file.txt");
 }
+
+// ============================================================================
+// Tests for DirectoryRange
+// ============================================================================
+
+TEST_F(DirectoryOperationsTest, DirectoryRange_AppliesSettings_SkipsDirectoriesAndExcluded)
+{
+    createFile("a.txt");
+    createFile("b.cpp");
+    createFile("c.txt");
+    createFile("skip.txt");
+    fs::create_directories(testDir + "/nested.txt");
+
+    stevensFileLib::ListFilesSettings settings;
+    settings.targetExtensions = {".txt"};
+    settings.excludeFiles = {"skip.txt"};
+
+    std::vector<std::string> names;
+    for (const auto& entry : stevensFileLib::DirectoryRange(testDir, settings))
+        names.push_back(entry.path().filename().string());
+    std::sort(names.begin(), names.end());
+
+    EXPECT_EQ(names, (std::vector<std::string>{"a.txt", "c.txt"}));
+}
+
+TEST_F(DirectoryOperationsTest, DirectoryRange_BreakEarly_ResumesWhereItStopped)
+{
+    for (int i = 0; i < 20; ++i)
+        createFile("file_" + std::to_string(i) + ".txt");
+
+    stevensFileLib::DirectoryRange range(testDir);
+    std::vector<std::string> names;
+    for (const auto& entry : range)
+    {
+        names.push_back(entry.path().filename().string());
+        if (names.size() == 5)
+            break;
+    }
+    ASSERT_EQ(names.size(), 5);
+
+    // The break left the iterator on the fifth entry, so resuming yields it again
+    for (const auto& entry : range)
+        names.push_back(entry.path().filename().string());
+    std::sort(names.begin(), names.end());
+    names.erase(std::unique(names.begin(), names.end()), names.end());
+
+    EXPECT_EQ(names.size(), 20);
+}
+
+TEST_F(DirectoryOperationsTest, DirectoryRange_EmptyDirectory_BeginEqualsEnd)
+{
+    stevensFileLib::DirectoryRange range(testDir);
+
+    EXPECT_TRUE(range.begin() == range.end());
+}
+
+TEST_F(DirectoryOperationsTest, DirectoryRange_DirectoryDoesNotExist_ThrowsException)
+{
+    EXPECT_THROW(stevensFileLib::DirectoryRange("nonexistent_directory"), std::invalid_argument);
+}
+
+// ============================================================================
+// Tests for listFilesPage
+// ============================================================================
+
+namespace
+{
+    std::vector<std::string> collectAllPages(const std::string& directory, stevensFileLib::ListPageOptions options,
+                                             size_t& pageCount)
+    {
+        std::vector<std::string> names;
+        pageCount = 0;
+        do
+        {
+            auto page = stevensFileLib::listFilesPage(directory, options);
+            EXPECT_LE(page.fileNames.size(), options.limit);
+            names.insert(names.end(), page.fileNames.begin(), page.fileNames.end());
+            options.cursor = page.nextCursor;
+            ++pageCount;
+        } while (!options.cursor.empty() && pageCount < 100);
+        return names;
+    }
+}
+
+TEST_F(DirectoryOperationsTest, ListFilesPage_SortedByName_PagesCoverAllInOrder)
+{
+    std::vector<std::string> expected;
+    for (int i = 0; i < 25; ++i)
+    {
+        expected.push_back("file_" + std::to_string(100 + i) + ".txt");
+        createFile(expected.back());
+    }
+
+    stevensFileLib::ListPageOptions options;
+    options.limit = 10;
+    size_t pageCount = 0;
+    auto names = collectAllPages(testDir, options, pageCount);
+
+    EXPECT_EQ(pageCount, 3);
+    EXPECT_EQ(names, expected);
+}
+
+TEST_F(DirectoryOperationsTest, ListFilesPage_Descending_ReversesOrder)
+{
+    createFile("a.txt");
+    createFile("b.txt");
+    createFile("c.txt");
+
+    stevensFileLib::ListPageOptions options;
+    options.limit = 2;
+    options.descending = true;
+    size_t pageCount = 0;
+    auto names = collectAllPages(testDir, options, pageCount);
+
+    EXPECT_EQ(names, (std::vector<std::string>{"c.txt", "b.txt", "a.txt"}));
+}
+
+TEST_F(DirectoryOperationsTest, ListFilesPage_SortedBySize_TiesBrokenByName)
+{
+    const std::vector<std::pair<std::string, size_t>> files = {
+        {"large.txt", 300}, {"small.txt", 10}, {"medium_b.txt", 100}, {"medium_a.txt", 100}, {"empty.txt", 0}
+    };
+    for (const auto& [name, size] : files)
+    {
+        std::ofstream file(testDir + "/" + name);
+        file << std::string(size, 'x');
+    }
+
+    stevensFileLib::ListPageOptions options;
+    options.limit = 2;
+    options.sortBy = stevensFileLib::ListSortKey::Size;
+    size_t pageCount = 0;
+    auto names = collectAllPages(testDir, options, pageCount);
+
+    EXPECT_EQ(names, (std::vector<std::string>{"empty.txt", "small.txt", "medium_a.txt", "medium_b.txt", "large.txt"}));
+}
+
+TEST_F(DirectoryOperationsTest, ListFilesPage_SortedByModifiedTime_NewestFirst)
+{
+    const auto now = fs::file_time_type::clock::now();
+    const std::vector<std::string> names = {"old.txt", "middle.txt", "new.txt"};
+    for (size_t i = 0; i < names.size(); ++i)
+    {
+        createFile(names[i]);
+        fs::last_write_time(testDir + "/" + names[i], now - std::chrono::hours(24 * (3 - i)));
+    }
+
+    stevensFileLib::ListPageOptions options;
+    options.sortBy = stevensFileLib::ListSortKey::ModifiedTime;
+    options.descending = true;
+    auto page = stevensFileLib::listFilesPage(testDir, options);
+
+    EXPECT_EQ(page.fileNames, (std::vector<std::string>{"new.txt", "middle.txt", "old.txt"}));
+    EXPECT_TRUE(page.nextCursor.empty());
+}
+
+TEST_F(DirectoryOperationsTest, ListFilesPage_Unsorted_PagesCoverAllOnce)
+{
+    for (int i = 0; i < 23; ++i)
+        createFile("file_" + std::to_string(i) + ".txt");
+
+    stevensFileLib::ListPageOptions options;
+    options.limit = 5;
+    options.sortBy = stevensFileLib::ListSortKey::None;
+    size_t pageCount = 0;
+    auto names = collectAllPages(testDir, options, pageCount);
+
+    EXPECT_EQ(pageCount, 5);
+    EXPECT_EQ(names.size(), 23);
+    std::sort(names.begin(), names.end());
+    EXPECT_TRUE(std::adjacent_find(names.begin(), names.end()) == names.end());
+}
+
+TEST_F(DirectoryOperationsTest, ListFilesPage_DirectoryChangesBetweenPages_NoRepeatsOrSkips)
+{
+    for (const char* name : {"a.txt", "b.txt", "c.txt", "d.txt", "e.txt"})
+        createFile(name);
+
+    stevensFileLib::ListPageOptions options;
+    options.limit = 2;
+    auto first = stevensFileLib::listFilesPage(testDir, options);
+    ASSERT_EQ(first.fileNames, (std::vector<std::string>{"a.txt", "b.txt"}));
+
+    fs::remove(testDir + "/a.txt");
+    createFile("aa.txt");
+    options.cursor = first.nextCursor;
+    auto second = stevensFileLib::listFilesPage(testDir, options);
+
+    EXPECT_EQ(second.fileNames, (std::vector<std::string>{"c.txt", "d.txt"}));
+}
+
+TEST_F(DirectoryOperationsTest, ListFilesPage_WithFilters_AppliesSettings)
+{
+    createFile("a.txt");
+    createFile("b.cpp");
+    createFile("c.txt");
+
+    std::unordered_map<std::string, std::string> settings;
+    settings["targetFileExtensions"] = ".txt";
+    auto page = stevensFileLib::listFilesPage(testDir, {}, settings);
+
+    EXPECT_EQ(page.fileNames, (std::vector<std::string>{"a.txt", "c.txt"}));
+}
+
+TEST_F(DirectoryOperationsTest, ListFilesPage_BadArguments_ThrowInvalidArgument)
+{
+    createFile("a.txt");
+    createFile("b.txt");
+
+    stevensFileLib::ListPageOptions options;
+    options.limit = 1;
+    std::string nameCursor = stevensFileLib::listFilesPage(testDir, options).nextCursor;
+    ASSERT_FALSE(nameCursor.empty());
+
+    options.sortBy = stevensFileLib::ListSortKey::Size;
+    options.cursor = nameCursor;
+    EXPECT_THROW(stevensFileLib::listFilesPage(testDir, options), std::invalid_argument);
+
+    options.sortBy = stevensFileLib::ListSortKey::Name;
+    options.cursor = "not a cursor";
+    EXPECT_THROW(stevensFileLib::listFilesPage(testDir, options), std::invalid_argument);
+
+    options.cursor.clear();
+    options.limit = 0;
+    EXPECT_THROW(stevensFileLib::listFilesPage(testDir, options), std::invalid_argument);
+
+    EXPECT_THROW(stevensFileLib::listFilesPage("nonexistent_directory"), std::invalid_argument);
+}
+
+// ============================================================================
+// Tests for loadDirectory
+// ============================================================================
+
+TEST_F(DirectoryOperationsTest, LoadDirectory_ManyFiles_LoadsAllInNameOrder)
+{
+    for (int i = 0; i < 50; ++i)
+    {
+        std::ofstream file(testDir + "/shard_" + std::to_string(100 + i) + ".txt");
+        file << "first " << i << "\n\nsecond " << i << "\n";
+    }
+
+    auto files = stevensFileLib::loadDirectory(testDir, {}, {}, 4);
+
+    ASSERT_EQ(files.size(), 50);
+    for (int i = 0; i < 50; ++i)
+    {
+        EXPECT_EQ(files[i].fileName, "shard_" + std::to_string(100 + i) + ".txt");
+        ASSERT_EQ(files[i].lines.size(), 2);
+        EXPECT_EQ(files[i].lines[1], "second " + std::to_string(i));
+    }
+}
+
+TEST_F(DirectoryOperationsTest, LoadDirectory_WithFilters_AppliesListAndLoadSettings)
+{
+    createFile("data.txt");
+    createFile("skip.log");
+    {
+        std::ofstream file(testDir + "/comments.txt");
+        file << "# comment\nvalue\n";
+    }
+
+    std::unordered_map<std::string, std::string> listSettings;
+    listSettings["targetFileExtensions"] = ".txt";
+    std::unordered_map<std::string, std::vector<std::string>> loadSettings;
+    loadSettings["skip if starts with"] = {"#"};
+
+    auto files = stevensFileLib::loadDirectory(testDir, listSettings, loadSettings);
+
+    ASSERT_EQ(files.size(), 2);
+    EXPECT_EQ(files[0].fileName, "comments.txt");
+    EXPECT_EQ(files[0].lines, (std::vector<std::string>{"value"}));
+    EXPECT_EQ(files[1].fileName, "data.txt");
+}
+
+TEST_F(DirectoryOperationsTest, LoadDirectory_DirectoryDoesNotExist_ThrowsException)
+{
+    EXPECT_THROW(stevensFileLib::loadDirectory("nonexistent_directory"), std::invalid_argument);
+}
@@ -0,0 +1,244 @@
+#include "stevensFileLib.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <future>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    /**
+     * @brief Runs every task inline and counts submissions
+     */
+    class InlineExecutor : public stevensFileLib::Executor
+    {
+    public:
+        void submit(std::function<void()> task) override
+        {
+            ++submitted;
+            task();
+        }
+
+        size_t concurrency() const override { return 2; }
+
+        std::atomic<size_t> submitted{0};
+    };
+}
+
+// ============================================================================
+// Tests for ThreadPool
+// ============================================================================
+
+TEST(ExecutorTest, ThreadPool_ManyTasks_RunsEveryTaskBeforeDestruction)
+{
+    std::atomic<int> completed{0};
+    {
+        stevensFileLib::ThreadPool pool(4);
+        EXPECT_EQ(pool.concurrency(), 4);
+        for (int i = 0; i < 1000; ++i)
+            pool.submit([&completed] { ++completed; });
+    }
+
+    EXPECT_EQ(completed, 1000);
+}
+
+TEST(ExecutorTest, ThreadPool_TasksSubmittingTasks_AllComplete)
+{
+    std::atomic<int> completed{0};
+    {
+        stevensFileLib::ThreadPool pool(3);
+        for (int i = 0; i < 10; ++i)
+        {
+            pool.submit([&pool, &completed]
+            {
+                for (int j = 0; j < 10; ++j)
+                    pool.submit([&completed] { ++completed; });
+            });
+        }
+    }
+
+    EXPECT_EQ(completed, 100);
+}
+
+TEST(ExecutorTest, ThreadPool_TaskThrows_OtherTasksStillRun)
+{
+    std::atomic<int> completed{0};
+    {
+        stevensFileLib::ThreadPool pool(2);
+        for (int i = 0; i < 100; ++i)
+        {
+            pool.submit([&completed, i]
+            {
+                if (i % 10 == 0)
+                    throw std::runtime_error("task failed");
+                ++completed;
+            });
+        }
+    }
+
+    EXPECT_EQ(completed, 90);
+}
+
+// ============================================================================
+// Tests for parallelFor
+// ============================================================================
+
+TEST(ExecutorTest, ParallelFor_CoversEveryIndexExactlyOnce)
+{
+    stevensFileLib::ThreadPool pool(4);
+    std::vector<std::atomic<int>> hits(500);
+
+    stevensFileLib::internal::parallelFor(hits.size(), 0, [&hits](size_t index) { ++hits[index]; }, pool);
+
+    for (const auto& hit : hits)
+        ASSERT_EQ(hit, 1);
+}
+
+TEST(ExecutorTest, ParallelFor_NestedInsideSingleThreadPool_DoesNotDeadlock)
+{
+    stevensFileLib::ThreadPool pool(1);
+    std::atomic<int> total{0};
+    std::promise<void> done;
+
+    pool.submit([&]
+    {
+        stevensFileLib::internal::parallelFor(100, 0, [&total](size_t) { ++total; }, pool);
+        done.set_value();
+    });
+
+    done.get_future().wait();
+    EXPECT_EQ(total, 100);
+}
+
+TEST(ExecutorTest, ParallelFor_TaskThrows_RethrowsToCaller)
+{
+    stevensFileLib::ThreadPool pool(2);
+
+    auto task = [](size_t index)
+    {
+        if (index == 7)
+            throw std::runtime_error("boom");
+    };
+
+    EXPECT_THROW(stevensFileLib::internal::parallelFor(50, 0, task, pool), std::runtime_error);
+}
+
+// ============================================================================
+// Tests for executor injection
+// ============================================================================
+
+TEST(ExecutorTest, LoadDirectory_InjectedExecutor_IsUsed)
+{
+    const std::string testDir = "test_executor_files";
+    fs::create_directories(testDir);
+    for (int i = 0; i < 5; ++i)
+        std::ofstream(testDir + "/file" + std::to_string(i) + ".txt") << "line\n";
+
+    auto executor = std::make_shared<InlineExecutor>();
+    auto files = stevensFileLib::loadDirectory(testDir, {}, {}, 0, '\n', true, {}, executor);
+    fs::remove_all(testDir);
+
+    EXPECT_EQ(files.size(), 5);
+    EXPECT_GT(executor->submitted, 0);
+}
+
+TEST(ExecutorTest, SetDefaultExecutor_ReplacesAndRestoresDefault)
+{
+    auto executor = std::make_shared<InlineExecutor>();
+
+    stevensFileLib::setDefaultExecutor(executor);
+    EXPECT_EQ(stevensFileLib::defaultExecutor(), executor);
+
+    stevensFileLib::setDefaultExecutor(nullptr);
+    EXPECT_NE(stevensFileLib::defaultExecutor(), executor);
+}
+
+// ============================================================================
+// Tests for asynchronous file operations
+// ============================================================================
+
+class AsyncOperationsTest : public ::testing::Test
+{
+protected:
+    const std::string testDir = "test_async_files";
+    const std::string testFile = testDir + "/async.txt";
+    std::shared_ptr<stevensFileLib::ThreadPool> pool = std::make_shared<stevensFileLib::ThreadPool>(2);
+
+    void SetUp() override
+    {
+        fs::create_directories(testDir);
+    }
+
+    void TearDown() override
+    {
+        if (fs::exists(testDir))
+            fs::remove_all(testDir);
+    }
+};
+
+TEST_F(AsyncOperationsTest, WriteThenLoadAsync_RoundTripsLines)
+{
+    stevensFileLib::writeLinesToFileAsync(testFile, {"one", "two"}, '\n',
+                                          stevensFileLib::WriteMode::Truncate, pool).get();
+
+    auto lines = stevensFileLib::loadFileIntoVectorAsync(testFile, {}, '\n', true, {}, pool).get();
+
+    EXPECT_EQ(lines, (std::vector<std::string>{"one", "two"}));
+}
+
+TEST_F(AsyncOperationsTest, AppendAndRandomLineAsync_UseDefaultExecutor)
+{
+    stevensFileLib::appendToFileAsync(testFile, std::string("only line\n")).get();
+
+    EXPECT_EQ(stevensFileLib::getRandomFileLineAsync(testFile).get(), "only line");
+}
+
+TEST_F(AsyncOperationsTest, GetRandomFileLineAsync_ConcurrentCalls_EachReturnAFileLine)
+{
+    stevensFileLib::writeLinesToFile(testFile, {"alpha", "beta", "gamma", "delta"});
+    auto workers = std::make_shared<stevensFileLib::ThreadPool>(4);
+
+    std::vector<std::future<std::string>> lines;
+    for (int i = 0; i < 8; ++i)
+        lines.push_back(stevensFileLib::getRandomFileLineAsync(testFile, '\n', {}, workers));
+
+    for (auto& line : lines)
+    {
+        std::string value = line.get();
+        EXPECT_TRUE(value == "alpha" || value == "beta" || value == "gamma" || value == "delta") << value;
+    }
+}
+
+TEST_F(AsyncOperationsTest, ListFilesAndLoadDirectoryAsync_ReturnDirectoryContents)
+{
+    stevensFileLib::writeFileAtomicAsync(testDir + "/a.txt", "1 2 3\n", {}, pool).get();
+    stevensFileLib::writeFileAtomicAsync(testDir + "/b.txt", "4\n", {}, pool).get();
+
+    auto files = stevensFileLib::listFilesAsync(testDir, {}, pool).get();
+    auto loaded = stevensFileLib::loadDirectoryAsync(testDir, {}, {}, 0, '\n', true, {}, pool).get();
+    auto numbers = stevensFileLib::loadFileIntoVectorOfIntsAsync(testDir + "/a.txt", {}, pool).get();
+
+    EXPECT_EQ(files.size(), 2);
+    ASSERT_EQ(loaded.size(), 2);
+    EXPECT_EQ(loaded[1].lines, (std::vector<std::string>{"4"}));
+    EXPECT_EQ(numbers, (std::vector<int>{1, 2, 3}));
+}
+
+TEST_F(AsyncOperationsTest, LoadDirectoryAsync_SeparatorAndEmptyLines_ForwardedToLoad)
+{
+    stevensFileLib::writeFileAtomicAsync(testDir + "/a.csv", "x,,y", {}, pool).get();
+
+    auto loaded = stevensFileLib::loadDirectoryAsync(testDir, {}, {}, 0, ',', false, {}, pool).get();
+
+    ASSERT_EQ(loaded.size(), 1);
+    EXPECT_EQ(loaded[0].lines, (std::vector<std::string>{"x", "", "y"}));
+}
+
+TEST_F(AsyncOperationsTest, LoadFileIntoVectorAsync_MissingFile_ExceptionDeliveredThroughFuture)
+{
+    auto future = stevensFileLib::loadFileIntoVectorAsync("nonexistent.txt", {}, '\n', true, {}, pool);
+
+    EXPECT_THROW(future.get(), std::invalid_argument);
+}
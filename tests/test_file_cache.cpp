@@ -0,0 +1,176 @@
+#include "stevensFileLib.hpp"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+class FileCacheTest : public ::testing::Test
+{
+protected:
+    const std::string testDir = "test_cache_files";
+    const std::string testFile = testDir + "/words.txt";
+
+    void SetUp() override
+    {
+        fs::create_directories(testDir);
+    }
+
+    void TearDown() override
+    {
+        if (fs::exists(testDir))
+            fs::remove_all(testDir);
+    }
+
+    void createTestFile(const std::string& path, const std::string& content)
+    {
+        std::ofstream file(path);
+        file << content;
+    }
+};
+
+// ============================================================================
+// Tests for FileCache
+// ============================================================================
+
+TEST_F(FileCacheTest, LoadLines_UnchangedFile_ReturnsSameHandle)
+{
+    createTestFile(testFile, "alpha\nbeta\n");
+    stevensFileLib::FileCache cache;
+
+    auto first = cache.loadLines(testFile);
+    auto second = cache.loadLines(testFile);
+
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_EQ(*first, (std::vector<std::string>{"alpha", "beta"}));
+    EXPECT_EQ(cache.stats().hits, 1);
+    EXPECT_EQ(cache.stats().misses, 1);
+}
+
+TEST_F(FileCacheTest, LoadLines_ModifiedFile_Reloads)
+{
+    createTestFile(testFile, "alpha\n");
+    stevensFileLib::FileCache cache;
+
+    auto first = cache.loadLines(testFile);
+    stevensFileLib::writeLinesAtomic(testFile, {"alpha", "beta", "gamma"});
+    auto second = cache.loadLines(testFile);
+
+    EXPECT_EQ(first->size(), 1);
+    EXPECT_EQ(second->size(), 3);
+    EXPECT_EQ(cache.stats().entries, 1);
+}
+
+TEST_F(FileCacheTest, LoadLines_DifferentSettings_CachedSeparately)
+{
+    createTestFile(testFile, "# comment\nvalue\n");
+    stevensFileLib::FileCache cache;
+
+    stevensFileLib::LoadSettings skipComments;
+    skipComments.skipIfStartsWith = {"#"};
+
+    EXPECT_EQ(cache.loadLines(testFile)->size(), 2);
+    EXPECT_EQ(cache.loadLines(testFile, skipComments)->size(), 1);
+    EXPECT_EQ(cache.stats().entries, 2);
+
+    cache.invalidate(testFile);
+    EXPECT_EQ(cache.stats().entries, 0);
+}
+
+TEST_F(FileCacheTest, LoadLines_OverBudget_EvictsLeastRecentlyUsed)
+{
+    const std::string otherFile = testDir + "/other.txt";
+    createTestFile(testFile, std::string(1000, 'a') + "\n");
+    createTestFile(otherFile, std::string(1000, 'b') + "\n");
+    stevensFileLib::FileCache cache(1500);
+
+    auto evicted = cache.loadLines(testFile);
+    cache.loadLines(otherFile);
+
+    EXPECT_EQ(cache.stats().entries, 1);
+    EXPECT_EQ(cache.stats().evictions, 1);
+    EXPECT_EQ(evicted->front().size(), 1000);
+}
+
+TEST_F(FileCacheTest, LoadLines_FileDoesNotExist_ThrowsException)
+{
+    stevensFileLib::FileCache cache;
+
+    EXPECT_THROW(cache.loadLines("nonexistent.txt"), std::invalid_argument);
+}
+
+TEST_F(FileCacheTest, LoadFileIntoVectorCached_UsesGlobalCache)
+{
+    createTestFile(testFile, "alpha\n\nbeta\n");
+
+    auto first = stevensFileLib::loadFileIntoVectorCached(testFile);
+    auto second = stevensFileLib::loadFileIntoVectorCached(testFile);
+
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_EQ(first->size(), 2);
+    stevensFileLib::FileCache::global().clear();
+}
+
+// ============================================================================
+// Tests for WatchedFile
+// ============================================================================
+
+namespace
+{
+    template<typename Predicate>
+    bool waitFor(Predicate predicate)
+    {
+        for (int attempt = 0; attempt < 500 && !predicate(); ++attempt)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        return predicate();
+    }
+}
+
+TEST_F(FileCacheTest, WatchedFile_InitialLoad_UsesLineLoader)
+{
+    createTestFile(testFile, "alpha\nbeta\n");
+
+    stevensFileLib::WatchedFile<> watched(testFile);
+
+    EXPECT_EQ(*watched.get(), (std::vector<std::string>{"alpha", "beta"}));
+    EXPECT_EQ(watched.version(), 0);
+}
+
+TEST_F(FileCacheTest, WatchedFile_FileChanges_PublishesNewSnapshot)
+{
+    createTestFile(testFile, "alpha\n");
+    stevensFileLib::WatchedFile<> watched(testFile, {}, std::chrono::milliseconds(5));
+    auto original = watched.get();
+
+    stevensFileLib::writeLinesAtomic(testFile, {"alpha", "beta"});
+
+    ASSERT_TRUE(waitFor([&] { return watched.version() == 1; }));
+    EXPECT_EQ(watched.get()->size(), 2);
+    EXPECT_EQ(original->size(), 1);
+}
+
+TEST_F(FileCacheTest, WatchedFile_ParserThrows_KeepsPreviousSnapshot)
+{
+    createTestFile(testFile, "1\n2\n");
+    auto sumParser = [](const std::string& path)
+    {
+        auto numbers = stevensFileLib::loadFileIntoVectorOfInts(path);
+        if (numbers.empty())
+            throw std::runtime_error("no numbers");
+        return numbers.front() + numbers.back();
+    };
+    stevensFileLib::WatchedFile<int> watched(testFile, sumParser, std::chrono::milliseconds(5));
+
+    stevensFileLib::writeFileAtomic(testFile, "not numbers\n");
+
+    ASSERT_TRUE(waitFor([&] { return watched.lastError() != nullptr; }));
+    EXPECT_EQ(*watched.get(), 3);
+    EXPECT_EQ(watched.version(), 0);
+}
+
+TEST_F(FileCacheTest, WatchedFile_CustomTypeWithoutParser_ThrowsException)
+{
+    createTestFile(testFile, "1\n");
+
+    EXPECT_THROW(stevensFileLib::WatchedFile<int> watched(testFile), std::invalid_argument);
+}
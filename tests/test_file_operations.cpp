@@ -1,5 +1,7 @@
 #include "stevensFileLib.hpp"
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <sstream>
 #include <filesystem>
 #include <fstream>
 
@@ -213,6 +215,35 @@ TEST_F(FileOperationsTest, LoadFileIntoVector_CustomSeparator_SplitsCorrectly)
     EXPECT_EQ(lines[2], "part3");
 }
 
+TEST_F(FileOperationsTest, LoadFileIntoVector_CrlfFile_MatchesTextModeGetline)
+{
+    {
+        std::ofstream file(testFile, std::ios::binary);
+        file << "alpha\r\nbeta\r\n\r\ngamma\r\n";
+    }
+
+    // Whatever the platform's text mode does with "\r\n", the loaders must agree with it
+    std::vector<std::string> allLines;
+    std::vector<std::string> expected;
+    std::ifstream textMode(testFile);
+    for (std::string line; std::getline(textMode, line);)
+    {
+        allLines.push_back(line);
+        if (!line.empty())
+            expected.push_back(line);
+    }
+
+    EXPECT_EQ(stevensFileLib::loadFileIntoVector(testFile), expected);
+
+    auto set = stevensFileLib::loadFileIntoHashSet(testFile);
+    EXPECT_EQ(set.size(), expected.size());
+    for (const auto& line : expected)
+        EXPECT_TRUE(set.contains(line)) << line;
+
+    std::string line = stevensFileLib::getRandomFileLine(testFile);
+    EXPECT_NE(std::find(allLines.begin(), allLines.end(), line), allLines.end()) << line;
+}
+
 TEST_F(FileOperationsTest, LoadFileIntoVector_FileDoesNotExist_ThrowsException)
 {
     EXPECT_THROW(stevensFileLib::loadFileIntoVector("nonexistent.txt"),
@@ -322,3 +353,396 @@ TEST_F(FileOperationsTest, GetRandomFileLine_FileDoesNotExist_ThrowsException)
     EXPECT_THROW(stevensFileLib::getRandomFileLine("nonexistent.txt"),
                  std::invalid_argument);
 }
+
+// ============================================================================
+// Tests for writeFileAtomic / writeLinesAtomic
+// ============================================================================
+
+TEST_F(FileOperationsTest, WriteFileAtomic_FileDoesNotExist_CreatesWithContent)
+{
+    stevensFileLib::writeFileAtomic(testFile, "line1\nline2\n");
+
+    auto lines = stevensFileLib::loadFileIntoVector(testFile);
+    ASSERT_EQ(lines.size(), 2);
+    EXPECT_EQ(lines[0], "line1");
+    EXPECT_EQ(lines[1], "line2");
+}
+
+TEST_F(FileOperationsTest, WriteFileAtomic_FileExists_ReplacesContent)
+{
+    createTestFile(testFile, "old content that is longer than the new one\n");
+
+    stevensFileLib::writeFileAtomic(testFile, "new\n");
+
+    auto lines = stevensFileLib::loadFileIntoVector(testFile);
+    ASSERT_EQ(lines.size(), 1);
+    EXPECT_EQ(lines[0], "new");
+}
+
+TEST_F(FileOperationsTest, WriteFileAtomic_LeavesNoTempFilesBehind)
+{
+    stevensFileLib::AtomicWriteSettings settings;
+    settings.fsyncPolicy = stevensFileLib::FsyncPolicy::Full;
+
+    stevensFileLib::writeFileAtomic(testFile, "first", settings);
+    stevensFileLib::writeFileAtomic(testFile, "second", settings);
+
+    auto files = stevensFileLib::listFiles(testDir);
+    ASSERT_EQ(files.size(), 1);
+    EXPECT_EQ(files[0], "test.txt");
+}
+
+TEST_F(FileOperationsTest, WriteFileAtomic_DirectoryDoesNotExist_ThrowsException)
+{
+    EXPECT_THROW(stevensFileLib::writeFileAtomic(testDir + "/missing/file.txt", "content"),
+                 std::runtime_error);
+}
+
+TEST_F(FileOperationsTest, WriteLinesAtomic_SmallBuffer_RoundTripsAllLines)
+{
+    std::vector<std::string> expected;
+    for (int i = 0; i < 1000; ++i)
+        expected.push_back("line" + std::to_string(i));
+
+    stevensFileLib::AtomicWriteSettings settings;
+    settings.bufferSize = 64;
+    settings.fsyncPolicy = stevensFileLib::FsyncPolicy::Data;
+
+    stevensFileLib::writeLinesAtomic(testFile, expected, '\n', settings);
+
+    EXPECT_EQ(stevensFileLib::loadFileIntoVector(testFile), expected);
+}
+
+// ============================================================================
+// Tests for writeLinesToFile
+// ============================================================================
+
+TEST_F(FileOperationsTest, WriteLinesToFile_ManyLines_RoundTripsThroughLoad)
+{
+    std::vector<std::string> expected;
+    for (int i = 0; i < 5000; ++i)
+        expected.push_back("line" + std::to_string(i));
+
+    stevensFileLib::writeLinesToFile(testFile, expected);
+
+    EXPECT_EQ(stevensFileLib::loadFileIntoVector(testFile), expected);
+}
+
+TEST_F(FileOperationsTest, WriteLinesToFile_TruncateMode_ReplacesContent)
+{
+    createTestFile(testFile, "old1\nold2\nold3\n");
+
+    stevensFileLib::writeLinesToFile(testFile, {"new"});
+
+    auto lines = stevensFileLib::loadFileIntoVector(testFile);
+    ASSERT_EQ(lines.size(), 1);
+    EXPECT_EQ(lines[0], "new");
+}
+
+TEST_F(FileOperationsTest, WriteLinesToFile_AppendMode_KeepsExistingContent)
+{
+    createTestFile(testFile, "existing\n");
+
+    stevensFileLib::writeLinesToFile(testFile, {"a", "", "b"}, '|',
+                                     stevensFileLib::WriteMode::Append);
+
+    std::ifstream file(testFile);
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(content, "existing\na||b|");
+}
+
+TEST_F(FileOperationsTest, WriteLinesToFile_DirectoryDoesNotExist_ThrowsException)
+{
+    EXPECT_THROW(stevensFileLib::writeLinesToFile(testDir + "/missing/file.txt", {"x"}),
+                 std::runtime_error);
+}
+
+TEST_F(FileOperationsTest, WriteLinesToFile_DeviceFull_ThrowsException)
+{
+    if (!fs::exists("/dev/full"))
+        GTEST_SKIP() << "/dev/full is not available";
+
+    EXPECT_THROW(stevensFileLib::writeLinesToFile("/dev/full", {"line"}), std::runtime_error);
+}
+
+// ============================================================================
+// Tests for ReadOptions
+// ============================================================================
+
+class ReadOptionsTest : public FileOperationsTest
+{
+protected:
+    std::vector<std::string> writeNumberedLines(size_t count)
+    {
+        std::vector<std::string> expected;
+        for (size_t i = 0; i < count; ++i)
+            expected.push_back("line number " + std::to_string(i) + std::string(i % 37, 'x'));
+        stevensFileLib::writeLinesToFile(testFile, expected);
+        return expected;
+    }
+};
+
+TEST_F(ReadOptionsTest, LoadFileIntoVector_SmallBuffer_LinesSpanChunkBoundaries)
+{
+    auto expected = writeNumberedLines(5000);
+
+    stevensFileLib::ReadOptions options;
+    options.bufferSize = 4096;
+
+    EXPECT_EQ(stevensFileLib::loadFileIntoVector(testFile, {}, '\n', true, options), expected);
+}
+
+TEST_F(ReadOptionsTest, LoadFileIntoVector_MemoryMap_LoadsAllLines)
+{
+    auto expected = writeNumberedLines(1000);
+
+    stevensFileLib::ReadOptions options;
+    options.memoryMap = true;
+    options.hugePages = true;
+
+    EXPECT_EQ(stevensFileLib::loadFileIntoVector(testFile, {}, '\n', true, options), expected);
+}
+
+TEST_F(ReadOptionsTest, LoadFileIntoVector_DirectIo_LoadsAllLines)
+{
+    auto expected = writeNumberedLines(1000);
+
+    stevensFileLib::ReadOptions options;
+    options.directIo = true;
+    options.accessPattern = stevensFileLib::ReadAccessPattern::NoReuse;
+
+    EXPECT_EQ(stevensFileLib::loadFileIntoVector(testFile, {}, '\n', true, options), expected);
+}
+
+TEST_F(ReadOptionsTest, LoadFileIntoVector_NoTrailingSeparator_KeepsLastLine)
+{
+    createTestFile(testFile, "a\n\nb");
+
+    stevensFileLib::ReadOptions options;
+    options.memoryMap = true;
+
+    auto lines = stevensFileLib::loadFileIntoVector(testFile, {}, '\n', false, options);
+    ASSERT_EQ(lines.size(), 3);
+    EXPECT_EQ(lines[1], "");
+    EXPECT_EQ(lines[2], "b");
+}
+
+TEST_F(ReadOptionsTest, LoadFileIntoVectorOfInts_SmallBuffer_NumbersSpanChunkBoundaries)
+{
+    std::vector<int> expected;
+    std::string content;
+    for (int i = 0; i < 3000; ++i)
+    {
+        expected.push_back(i * 7 - 1000);
+        content += std::to_string(i * 7 - 1000) + (i % 5 == 0 ? "\n" : " ");
+    }
+    createTestFile(testFileInts, content);
+
+    stevensFileLib::ReadOptions options;
+    options.bufferSize = 4096;
+
+    EXPECT_EQ(stevensFileLib::loadFileIntoVectorOfInts(testFileInts, {}, '\n', true, options), expected);
+}
+
+TEST_F(ReadOptionsTest, LoadFileIntoVectorOfInts_InvalidToken_StopsLikeStreamExtraction)
+{
+    createTestFile(testFileInts, "1 +2 3abc 4");
+
+    auto numbers = stevensFileLib::loadFileIntoVectorOfInts(testFileInts);
+
+    EXPECT_EQ(numbers, (std::vector<int>{1, 2, 3}));
+}
+
+TEST_F(ReadOptionsTest, LoadFileIntoVectorOfInts_SignInsideToken_StartsNextNumberLikeStreamExtraction)
+{
+    const std::string content = "1-2 3+4 5--6 7";
+    createTestFile(testFileInts, content);
+
+    std::istringstream stream(content);
+    std::vector<int> expected;
+    for (int value; stream >> value;)
+        expected.push_back(value);
+
+    auto numbers = stevensFileLib::loadFileIntoVectorOfInts(testFileInts);
+
+    EXPECT_EQ(numbers, (std::vector<int>{1, -2, 3, 4, 5}));
+    EXPECT_EQ(numbers, expected);
+}
+
+TEST_F(ReadOptionsTest, GetRandomFileLine_MemoryMap_ReturnsExistingLine)
+{
+    auto expected = writeNumberedLines(100);
+
+    stevensFileLib::ReadOptions options;
+    options.memoryMap = true;
+
+    std::string line = stevensFileLib::getRandomFileLine(testFile, '\n', options);
+    EXPECT_NE(std::find(expected.begin(), expected.end(), line), expected.end());
+}
+
+TEST_F(ReadOptionsTest, LoadFileIntoVector_StreamingMode_LoadsAllLines)
+{
+    auto expected = writeNumberedLines(5000);
+
+    auto options = stevensFileLib::ReadOptions::streaming();
+    options.bufferSize = 4096;
+
+    EXPECT_TRUE(options.dropCache);
+    EXPECT_EQ(stevensFileLib::loadFileIntoVector(testFile, {}, '\n', true, options), expected);
+}
+
+TEST_F(ReadOptionsTest, LoadFileIntoVector_StreamingMemoryMap_LoadsAllLines)
+{
+    auto expected = writeNumberedLines(1000);
+
+    auto options = stevensFileLib::ReadOptions::streaming();
+    options.memoryMap = true;
+
+    EXPECT_EQ(stevensFileLib::loadFileIntoVector(testFile, {}, '\n', true, options), expected);
+}
+
+// ============================================================================
+// Tests for LineReader
+// ============================================================================
+
+TEST_F(ReadOptionsTest, LineReader_SmallBuffer_YieldsSameLinesAsLoadFileIntoVector)
+{
+    auto expected = writeNumberedLines(3000);
+
+    stevensFileLib::ReadOptions options;
+    options.bufferSize = 4096;
+    stevensFileLib::LineReader reader(testFile, {}, options);
+
+    std::vector<std::string> lines;
+    std::string_view line;
+    while (reader.next(line))
+        lines.emplace_back(line);
+
+    EXPECT_EQ(lines, expected);
+}
+
+TEST_F(FileOperationsTest, LineReader_WithFilters_SkipsFilteredLines)
+{
+    createTestFile(testFile, "# comment\nkeep\n\nskip me\nlast");
+
+    stevensFileLib::LoadSettings settings;
+    settings.skipIfStartsWith = {"#"};
+    settings.skipIfContains = {"skip"};
+    stevensFileLib::LineReader reader(testFile, settings);
+
+    std::string_view line;
+    ASSERT_TRUE(reader.next(line));
+    EXPECT_EQ(line, "keep");
+    ASSERT_TRUE(reader.next(line));
+    EXPECT_EQ(line, "last");
+    EXPECT_FALSE(reader.next(line));
+}
+
+TEST_F(FileOperationsTest, LineReader_FileDoesNotExist_ThrowsException)
+{
+    EXPECT_THROW(stevensFileLib::LineReader(testDir + "/missing.txt"), std::invalid_argument);
+}
+
+// ============================================================================
+// Tests for loadDelimitedFile
+// ============================================================================
+
+TEST_F(FileOperationsTest, LoadDelimitedFile_SimpleCsv_SplitsIntoColumns)
+{
+    createTestFile(testFile, "a,b,c\n1,2,3\n");
+
+    auto table = stevensFileLib::loadDelimitedFile(testFile);
+
+    ASSERT_EQ(table.rowCount(), 2);
+    ASSERT_EQ(table.columnCount(), 3);
+    EXPECT_EQ(table.field(0, 0), "a");
+    EXPECT_EQ(table.field(1, 2), "3");
+    EXPECT_EQ(table.column(1), (std::vector<std::string_view>{"b", "2"}));
+}
+
+TEST_F(FileOperationsTest, LoadDelimitedFile_QuotedFields_UnquotesSeparatorsAndNewlines)
+{
+    createTestFile(testFile, "\"x,y\",\"say \"\"hi\"\"\",\"multi\nline\"\r\nplain,,end\r\n");
+
+    auto table = stevensFileLib::loadDelimitedFile(testFile);
+
+    ASSERT_EQ(table.rowCount(), 2);
+    EXPECT_EQ(table.field(0, 0), "x,y");
+    EXPECT_EQ(table.field(0, 1), "say \"hi\"");
+    EXPECT_EQ(table.field(0, 2), "multi\nline");
+    EXPECT_EQ(table.field(1, 1), "");
+    EXPECT_EQ(table.field(1, 2), "end");
+}
+
+TEST_F(FileOperationsTest, LoadDelimitedFile_HeaderAndComments_AreSeparatedFromRows)
+{
+    createTestFile(testFile, "# generated\nname\tage\n\nann\t31\n# note\nbob\t42\n");
+
+    auto settings = stevensFileLib::DelimitedSettings::tsv();
+    settings.hasHeader = true;
+    settings.skipIfStartsWith = {"#"};
+
+    auto table = stevensFileLib::loadDelimitedFile(testFile, settings);
+
+    EXPECT_EQ(table.header(), (std::vector<std::string>{"name", "age"}));
+    ASSERT_EQ(table.rowCount(), 2);
+    EXPECT_EQ(table.field(1, table.columnIndex("age")), "42");
+    EXPECT_THROW(table.columnIndex("missing"), std::out_of_range);
+}
+
+TEST_F(FileOperationsTest, LoadDelimitedFile_RaggedRows_PadsMissingFields)
+{
+    createTestFile(testFile, "1\n2,3,4\n5,6");
+
+    auto table = stevensFileLib::loadDelimitedFile(testFile);
+
+    ASSERT_EQ(table.rowCount(), 3);
+    ASSERT_EQ(table.columnCount(), 3);
+    EXPECT_EQ(table.field(0, 2), "");
+    EXPECT_EQ(table.field(1, 2), "4");
+    EXPECT_EQ(table.field(2, 1), "6");
+    EXPECT_EQ(table.field(2, 2), "");
+}
+
+TEST_F(FileOperationsTest, LoadDelimitedFile_TrailingSeparatorAtEof_StoresEmptyField)
+{
+    createTestFile(testFile, "a,b,");
+
+    auto table = stevensFileLib::loadDelimitedFile(testFile);
+
+    ASSERT_EQ(table.rowCount(), 1);
+    ASSERT_EQ(table.columnCount(), 3);
+    EXPECT_EQ(table.field(0, 0), "a");
+    EXPECT_EQ(table.field(0, 1), "b");
+    EXPECT_EQ(table.field(0, 2), "");
+}
+
+TEST_F(FileOperationsTest, LoadDelimitedFile_QuotedFieldThenSeparatorAtEof_StoresEmptyField)
+{
+    createTestFile(testFile, "\"a\",");
+
+    auto table = stevensFileLib::loadDelimitedFile(testFile);
+
+    ASSERT_EQ(table.rowCount(), 1);
+    ASSERT_EQ(table.columnCount(), 2);
+    EXPECT_EQ(table.field(0, 0), "a");
+    EXPECT_EQ(table.field(0, 1), "");
+}
+
+TEST_F(FileOperationsTest, LoadDelimitedFile_FileDoesNotExist_ThrowsException)
+{
+    EXPECT_THROW(stevensFileLib::loadDelimitedFile("nonexistent.csv"), std::invalid_argument);
+}
+
+// ============================================================================
+// Tests for instrumentation (compiled out by default)
+// ============================================================================
+
+TEST_F(FileOperationsTest, InstrumentationSnapshot_NotEnabled_RecordsNothing)
+{
+    createTestFile(testFile, "line\n");
+    stevensFileLib::loadFileIntoVector(testFile);
+
+    EXPECT_FALSE(stevensFileLib::instrumentationEnabled);
+    EXPECT_TRUE(stevensFileLib::instrumentationSnapshot().operations.empty());
+}
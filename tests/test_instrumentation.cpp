@@ -0,0 +1,136 @@
+// Built as its own executable with STEVENS_FILE_LIB_INSTRUMENTATION=1; mixing translation
+// units compiled with and without the define in one program would violate the ODR.
+#include "stevensFileLib.hpp"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+class InstrumentationTest : public ::testing::Test
+{
+protected:
+    const std::string testDir = "test_files_instrumentation";
+    const std::string testFile = testDir + "/test.txt";
+
+    void SetUp() override
+    {
+        fs::create_directories(testDir);
+        stevensFileLib::resetInstrumentation();
+    }
+
+    void TearDown() override
+    {
+        if (fs::exists(testDir))
+            fs::remove_all(testDir);
+    }
+
+    void createTestFile(const std::string& path, const std::string& content)
+    {
+        std::ofstream file(path);
+        file << content;
+    }
+
+    static stevensFileLib::OperationMetrics metricsFor(stevensFileLib::Operation operation)
+    {
+        auto snapshot = stevensFileLib::instrumentationSnapshot();
+        const auto* metrics = snapshot.find(operation);
+        return metrics ? *metrics : stevensFileLib::OperationMetrics{};
+    }
+};
+
+TEST_F(InstrumentationTest, LoadFileIntoVector_RecordsCallLinesBytesAndSyscalls)
+{
+    createTestFile(testFile, "one\ntwo\nthree\n");
+
+    stevensFileLib::loadFileIntoVector(testFile);
+
+    auto metrics = metricsFor(stevensFileLib::Operation::LoadFileIntoVector);
+    EXPECT_EQ(metrics.calls, 1);
+    EXPECT_EQ(metrics.errors, 0);
+    EXPECT_EQ(metrics.lines, 3);
+    EXPECT_EQ(metrics.bytesRead, 14);
+    EXPECT_EQ(metrics.bytesWritten, 0);
+    EXPECT_GE(metrics.syscalls, 1);
+}
+
+TEST_F(InstrumentationTest, MissingFile_CountsError)
+{
+    EXPECT_THROW(stevensFileLib::loadFileIntoVector(testDir + "/missing.txt"), std::invalid_argument);
+
+    auto metrics = metricsFor(stevensFileLib::Operation::LoadFileIntoVector);
+    EXPECT_EQ(metrics.calls, 1);
+    EXPECT_EQ(metrics.errors, 1);
+}
+
+TEST_F(InstrumentationTest, Writes_RecordBytesWritten)
+{
+    stevensFileLib::writeLinesToFile(testFile, {"alpha", "beta"});
+    stevensFileLib::writeFileAtomic(testFile, "hello");
+    stevensFileLib::appendToFile(testFile, std::string("!!"));
+
+    EXPECT_EQ(metricsFor(stevensFileLib::Operation::WriteLinesToFile).bytesWritten, 11);
+    EXPECT_EQ(metricsFor(stevensFileLib::Operation::WriteLinesToFile).lines, 2);
+    EXPECT_EQ(metricsFor(stevensFileLib::Operation::WriteFileAtomic).bytesWritten, 5);
+    EXPECT_EQ(metricsFor(stevensFileLib::Operation::AppendToFile).bytesWritten, 2);
+}
+
+TEST_F(InstrumentationTest, LoadDirectory_AttributesWorkerReadsAndNestedListFiles)
+{
+    for (int i = 0; i < 8; ++i)
+        createTestFile(testDir + "/file" + std::to_string(i) + ".txt", "abc\ndef\n");
+
+    stevensFileLib::loadDirectory(testDir, {}, {}, 4, '\n', true, {},
+                                  std::make_shared<stevensFileLib::ThreadPool>(4));
+
+    auto metrics = metricsFor(stevensFileLib::Operation::LoadDirectory);
+    EXPECT_EQ(metrics.calls, 1);
+    EXPECT_EQ(metrics.lines, 16);
+    EXPECT_EQ(metrics.bytesRead, 64);
+    EXPECT_EQ(metricsFor(stevensFileLib::Operation::ListFiles).calls, 1);
+}
+
+TEST_F(InstrumentationTest, LatencyHistogram_QuantilesAreOrdered)
+{
+    createTestFile(testFile, "line\n");
+    for (int i = 0; i < 50; ++i)
+        stevensFileLib::getRandomFileLine(testFile);
+
+    auto metrics = metricsFor(stevensFileLib::Operation::GetRandomFileLine);
+    ASSERT_EQ(metrics.calls, 50);
+
+    uint64_t bucketTotal = 0;
+    for (const auto& bucket : metrics.latency)
+        bucketTotal += bucket.count;
+    EXPECT_EQ(bucketTotal, 50);
+
+    EXPECT_GT(metrics.quantileNanoseconds(0.5), 0);
+    EXPECT_LE(metrics.quantileNanoseconds(0.5), metrics.quantileNanoseconds(0.99));
+    EXPECT_LE(metrics.quantileNanoseconds(0.99), metrics.quantileNanoseconds(1.0));
+}
+
+TEST_F(InstrumentationTest, ResetInstrumentation_ClearsCounters)
+{
+    createTestFile(testFile, "line\n");
+    stevensFileLib::loadFileIntoVector(testFile);
+
+    stevensFileLib::resetInstrumentation();
+
+    EXPECT_TRUE(stevensFileLib::instrumentationSnapshot().operations.empty());
+}
+
+TEST_F(InstrumentationTest, FormatPrometheus_EmitsCountersAndHistogram)
+{
+    createTestFile(testFile, "one\ntwo\n");
+    stevensFileLib::loadFileIntoVector(testFile);
+
+    std::string text = stevensFileLib::formatPrometheus(stevensFileLib::instrumentationSnapshot());
+
+    EXPECT_NE(text.find("# TYPE stevens_file_lib_calls_total counter"), std::string::npos);
+    EXPECT_NE(text.find("stevens_file_lib_calls_total{operation=\"loadFileIntoVector\"} 1"), std::string::npos);
+    EXPECT_NE(text.find("stevens_file_lib_lines_total{operation=\"loadFileIntoVector\"} 2"), std::string::npos);
+    EXPECT_NE(text.find("stevens_file_lib_latency_seconds_bucket{operation=\"loadFileIntoVector\",le=\"+Inf\"} 1"),
+              std::string::npos);
+    EXPECT_NE(text.find("stevens_file_lib_latency_seconds_count{operation=\"loadFileIntoVector\"} 1"),
+              std::string::npos);
+}
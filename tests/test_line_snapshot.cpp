@@ -0,0 +1,163 @@
+#include "stevensFileLib.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+namespace fs = std::filesystem;
+
+class LineSnapshotTest : public ::testing::Test
+{
+protected:
+    const std::string testDir = "test_snapshot_files";
+    const std::string snapshotFile = testDir + "/lines.snapshot";
+
+    void SetUp() override
+    {
+        fs::create_directories(testDir);
+    }
+
+    void TearDown() override
+    {
+        if (fs::exists(testDir))
+            fs::remove_all(testDir);
+    }
+
+    void corruptByteAt(std::streamoff offset)
+    {
+        std::fstream file(snapshotFile, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekg(offset);
+        char byte = static_cast<char>(file.get());
+        file.seekp(offset);
+        file.put(static_cast<char>(byte ^ 0x5A));
+    }
+
+    void overwriteUint64At(std::streamoff offset, uint64_t value)
+    {
+        std::fstream file(snapshotFile, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(offset);
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    // Header fields and the offset table, as laid out by saveLineSnapshot
+    static constexpr std::streamoff lineCountOffset = 16;
+    static constexpr std::streamoff blobSizeOffset = 24;
+    static constexpr std::streamoff offsetTable = 48;
+};
+
+// ============================================================================
+// Tests for saveLineSnapshot / LineSnapshot
+// ============================================================================
+
+TEST_F(LineSnapshotTest, SaveAndOpen_RoundTripsLinesExactly)
+{
+    std::vector<std::string> lines = {"alpha", "", "gamma with spaces", std::string(3, '\0')};
+
+    stevensFileLib::saveLineSnapshot(snapshotFile, lines);
+    stevensFileLib::LineSnapshot snapshot(snapshotFile);
+
+    ASSERT_EQ(snapshot.size(), lines.size());
+    for (size_t i = 0; i < lines.size(); ++i)
+        EXPECT_EQ(snapshot[i], lines[i]);
+    EXPECT_THROW(snapshot.at(lines.size()), std::out_of_range);
+}
+
+TEST_F(LineSnapshotTest, SaveAndOpen_IteratesInOrder)
+{
+    std::vector<std::string_view> lines = {"one", "two", "three"};
+
+    stevensFileLib::saveLineSnapshot(snapshotFile, lines);
+    stevensFileLib::LineSnapshot snapshot(snapshotFile);
+
+    std::vector<std::string_view> loaded(snapshot.begin(), snapshot.end());
+    EXPECT_EQ(loaded, lines);
+}
+
+TEST_F(LineSnapshotTest, Iterator_SupportsRandomAccessAlgorithms)
+{
+    std::vector<std::string> lines = {"apple", "banana", "cherry", "date", "elderberry"};
+
+    stevensFileLib::saveLineSnapshot(snapshotFile, lines);
+    stevensFileLib::LineSnapshot snapshot(snapshotFile);
+
+    auto it = snapshot.begin();
+    EXPECT_EQ(*std::next(it, 3), "date");
+    EXPECT_EQ(it[1], "banana");
+    EXPECT_EQ(*(snapshot.end() - 1), "elderberry");
+    EXPECT_TRUE(it < it + 2);
+    std::advance(it, 4);
+    EXPECT_EQ(*--it, "date");
+
+    auto found = std::lower_bound(snapshot.begin(), snapshot.end(), std::string_view("cherry"));
+    EXPECT_EQ(found - snapshot.begin(), 2);
+    EXPECT_TRUE(std::binary_search(snapshot.begin(), snapshot.end(), std::string_view("date")));
+}
+
+TEST_F(LineSnapshotTest, SaveAndOpen_EmptyTable_HasNoLines)
+{
+    stevensFileLib::saveLineSnapshot(snapshotFile, std::vector<std::string>{});
+
+    stevensFileLib::LineSnapshot snapshot(snapshotFile);
+
+    EXPECT_TRUE(snapshot.empty());
+}
+
+TEST_F(LineSnapshotTest, Open_CorruptBlob_ThrowsChecksumMismatch)
+{
+    stevensFileLib::saveLineSnapshot(snapshotFile, std::vector<std::string>{"some", "data"});
+    corruptByteAt(static_cast<std::streamoff>(fs::file_size(snapshotFile) - 1));
+
+    EXPECT_THROW(stevensFileLib::LineSnapshot snapshot(snapshotFile), std::runtime_error);
+    EXPECT_NO_THROW(stevensFileLib::LineSnapshot snapshot(snapshotFile, false));
+}
+
+TEST_F(LineSnapshotTest, Open_NotASnapshot_ThrowsException)
+{
+    stevensFileLib::writeFileAtomic(snapshotFile, "plain text, not a snapshot at all......................");
+
+    EXPECT_THROW(stevensFileLib::LineSnapshot snapshot(snapshotFile), std::runtime_error);
+}
+
+TEST_F(LineSnapshotTest, Open_Truncated_ThrowsException)
+{
+    stevensFileLib::saveLineSnapshot(snapshotFile, std::vector<std::string>{"some", "data"});
+    fs::resize_file(snapshotFile, fs::file_size(snapshotFile) - 2);
+
+    EXPECT_THROW(stevensFileLib::LineSnapshot snapshot(snapshotFile, false), std::runtime_error);
+}
+
+TEST_F(LineSnapshotTest, Open_OffsetBeyondBlob_ThrowsException)
+{
+    stevensFileLib::saveLineSnapshot(snapshotFile, std::vector<std::string>{"ab", "cd", "ef"});
+    overwriteUint64At(offsetTable + 2 * 8, 1000);
+
+    EXPECT_THROW(stevensFileLib::LineSnapshot snapshot(snapshotFile, false), std::runtime_error);
+}
+
+TEST_F(LineSnapshotTest, Open_DecreasingOffsets_ThrowsException)
+{
+    stevensFileLib::saveLineSnapshot(snapshotFile, std::vector<std::string>{"ab", "cd", "ef"});
+    overwriteUint64At(offsetTable + 2 * 8, 1);
+
+    EXPECT_THROW(stevensFileLib::LineSnapshot snapshot(snapshotFile, false), std::runtime_error);
+}
+
+TEST_F(LineSnapshotTest, Open_HeaderCountsThatWrapAround_ThrowsException)
+{
+    stevensFileLib::saveLineSnapshot(snapshotFile, std::vector<std::string>{"ab", "cd", "ef"});
+    // (lineCount + 1) * 8 wraps to 0; blobSize wraps the total back to the real file size
+    overwriteUint64At(lineCountOffset, (uint64_t{1} << 61) - 1);
+    overwriteUint64At(blobSizeOffset, fs::file_size(snapshotFile) - 48);
+
+    EXPECT_THROW(stevensFileLib::LineSnapshot snapshot(snapshotFile, false), std::runtime_error);
+
+    overwriteUint64At(lineCountOffset, 3);
+    overwriteUint64At(blobSizeOffset, ~uint64_t{0});
+    EXPECT_THROW(stevensFileLib::LineSnapshot snapshot(snapshotFile, false), std::runtime_error);
+}
+
+TEST_F(LineSnapshotTest, Open_FileDoesNotExist_ThrowsException)
+{
+    EXPECT_THROW(stevensFileLib::LineSnapshot snapshot("nonexistent.snapshot"), std::invalid_argument);
+}
@@ -0,0 +1,206 @@
+#include "stevensFileLib.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+class LookupLoadersTest : public ::testing::Test
+{
+protected:
+    const std::string testDir = "test_lookup_files";
+    const std::string testFile = testDir + "/entries.txt";
+
+    void SetUp() override
+    {
+        fs::create_directories(testDir);
+    }
+
+    void TearDown() override
+    {
+        if (fs::exists(testDir))
+            fs::remove_all(testDir);
+    }
+
+    void createTestFile(const std::string& path, const std::string& content)
+    {
+        std::ofstream file(path);
+        file << content;
+    }
+};
+
+// ============================================================================
+// Tests for StringArena
+// ============================================================================
+
+TEST_F(LookupLoadersTest, StringArena_ViewsSurviveNewBlocksAndMoves)
+{
+    stevensFileLib::StringArena arena(8);
+    auto first = arena.store("hello");
+    auto second = arena.store("a string longer than one block");
+
+    stevensFileLib::StringArena moved(std::move(arena));
+    auto third = moved.store("world");
+
+    EXPECT_EQ(first, "hello");
+    EXPECT_EQ(second, "a string longer than one block");
+    EXPECT_EQ(third, "world");
+    EXPECT_EQ(moved.bytesUsed(), 40);
+}
+
+TEST_F(LookupLoadersTest, StringArena_EmptyTextBeforeFirstBlock_ReturnsEmptyView)
+{
+    stevensFileLib::StringArena arena;
+    auto empty = arena.store("");
+    auto next = arena.store("text");
+
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(next, "text");
+    EXPECT_EQ(arena.bytesUsed(), 4);
+}
+
+// ============================================================================
+// Tests for loadFileIntoHashSet
+// ============================================================================
+
+TEST_F(LookupLoadersTest, LoadFileIntoHashSet_Duplicates_StoredOnce)
+{
+    createTestFile(testFile, "apple\nbanana\napple\n\ncherry\nbanana\n");
+
+    auto set = stevensFileLib::loadFileIntoHashSet(testFile);
+
+    EXPECT_EQ(set.size(), 3);
+    EXPECT_TRUE(set.contains("apple"));
+    EXPECT_TRUE(set.contains("cherry"));
+    EXPECT_FALSE(set.contains("durian"));
+    EXPECT_FALSE(set.contains(""));
+}
+
+TEST_F(LookupLoadersTest, LoadFileIntoHashSet_ManyEntries_GrowsAndFindsAll)
+{
+    std::vector<std::string> lines;
+    for (int i = 0; i < 20000; ++i)
+        lines.push_back("entry" + std::to_string(i));
+    stevensFileLib::writeLinesToFile(testFile, lines);
+
+    auto set = stevensFileLib::loadFileIntoHashSet(testFile);
+
+    ASSERT_EQ(set.size(), lines.size());
+    for (const auto& line : lines)
+        ASSERT_TRUE(set.contains(line));
+    EXPECT_FALSE(set.contains("entry20000"));
+}
+
+TEST_F(LookupLoadersTest, OccupiedHash_NonZeroAndHomeSlotsUseEveryIndex)
+{
+    const size_t slotCount = 64;
+    std::vector<bool> homeUsed(slotCount, false);
+    for (int i = 0; i < 4096; ++i)
+    {
+        uint64_t hash = stevensFileLib::internal::occupiedHash("key" + std::to_string(i));
+        ASSERT_NE(hash, 0u);
+        homeUsed[static_cast<size_t>(hash) & (slotCount - 1)] = true;
+    }
+
+    EXPECT_EQ(std::count(homeUsed.begin(), homeUsed.end(), true), static_cast<long>(slotCount));
+}
+
+TEST_F(LookupLoadersTest, LoadFileIntoHashSet_SkipSettings_AppliedBeforeInsert)
+{
+    createTestFile(testFile, "# header\nkeep\n");
+
+    std::unordered_map<std::string, std::vector<std::string>> settings;
+    settings["skip if starts with"] = {"#"};
+
+    auto set = stevensFileLib::loadFileIntoHashSet(testFile, settings);
+
+    EXPECT_EQ(set.size(), 1);
+    EXPECT_FALSE(set.contains("# header"));
+}
+
+// ============================================================================
+// Tests for loadFileIntoSortedSet
+// ============================================================================
+
+TEST_F(LookupLoadersTest, LoadFileIntoSortedSet_Duplicates_SortedAndDistinct)
+{
+    createTestFile(testFile, "pear\napple\nfig\napple\n");
+
+    auto set = stevensFileLib::loadFileIntoSortedSet(testFile);
+
+    std::vector<std::string_view> values;
+    set.forEach([&values](std::string_view value) { values.push_back(value); });
+
+    EXPECT_EQ(values, (std::vector<std::string_view>{"apple", "fig", "pear"}));
+}
+
+TEST_F(LookupLoadersTest, LoadFileIntoSortedSet_Contains_FindsEveryElementOnly)
+{
+    std::vector<std::string> lines;
+    for (int i = 0; i < 1000; i += 2)
+        lines.push_back(std::to_string(i));
+    stevensFileLib::writeLinesToFile(testFile, lines);
+
+    auto set = stevensFileLib::loadFileIntoSortedSet(testFile);
+
+    ASSERT_EQ(set.size(), 500);
+    for (int i = 0; i < 1000; ++i)
+        ASSERT_EQ(set.contains(std::to_string(i)), i % 2 == 0) << i;
+}
+
+TEST_F(LookupLoadersTest, LoadFileIntoSortedSet_EmptyFile_ContainsNothing)
+{
+    createTestFile(testFile, "");
+
+    auto set = stevensFileLib::loadFileIntoSortedSet(testFile);
+
+    EXPECT_TRUE(set.empty());
+    EXPECT_FALSE(set.contains("anything"));
+}
+
+// ============================================================================
+// Tests for loadFileIntoMap
+// ============================================================================
+
+TEST_F(LookupLoadersTest, LoadFileIntoMap_EqualsSeparated_SplitsAtFirstSeparator)
+{
+    createTestFile(testFile, "host=example.com\nquery=a=b\nempty=\n");
+
+    auto map = stevensFileLib::loadFileIntoMap(testFile);
+
+    ASSERT_EQ(map.size(), 3);
+    EXPECT_EQ(map.at("host"), "example.com");
+    EXPECT_EQ(map.at("query"), "a=b");
+    EXPECT_EQ(map.at("empty"), "");
+    EXPECT_EQ(map.find("missing"), nullptr);
+    EXPECT_THROW(map.at("missing"), std::out_of_range);
+}
+
+TEST_F(LookupLoadersTest, LoadFileIntoMap_TabSeparatedWithComments_SkipsFilteredLines)
+{
+    createTestFile(testFile, "# routes\n/api\tbackend-1\n\nmalformed line\n/static\tcdn\n");
+
+    std::unordered_map<std::string, std::vector<std::string>> settings;
+    settings["skip if starts with"] = {"#"};
+
+    auto map = stevensFileLib::loadFileIntoMap(testFile, '\t', settings);
+
+    ASSERT_EQ(map.size(), 2);
+    EXPECT_EQ(map.at("/api"), "backend-1");
+    EXPECT_EQ(map.at("/static"), "cdn");
+}
+
+TEST_F(LookupLoadersTest, LoadFileIntoMap_DuplicateKeys_LastValueWins)
+{
+    std::vector<std::string> lines;
+    for (int i = 0; i < 10000; ++i)
+        lines.push_back("flag" + std::to_string(i % 5000) + "=" + std::to_string(i));
+    stevensFileLib::writeLinesToFile(testFile, lines);
+
+    auto map = stevensFileLib::loadFileIntoMap(testFile);
+
+    ASSERT_EQ(map.size(), 5000);
+    EXPECT_EQ(map.at("flag0"), "5000");
+    EXPECT_EQ(map.at("flag4999"), "9999");
+}
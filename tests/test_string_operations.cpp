@@ -0,0 +1,86 @@
+#include "stevensFileLib.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    std::vector<std::string_view> collect(std::string_view text, std::string_view delimiter)
+    {
+        std::vector<std::string_view> tokens;
+        for (std::string_view token : stevensFileLib::splitView(text, delimiter))
+            tokens.push_back(token);
+        return tokens;
+    }
+}
+
+// ============================================================================
+// Tests for splitView
+// ============================================================================
+
+TEST(StringOperationsTest, SplitView_SingleCharDelimiter_SplitsAllTokens)
+{
+    EXPECT_EQ(collect("a,b,c", ","), (std::vector<std::string_view>{"a", "b", "c"}));
+}
+
+TEST(StringOperationsTest, SplitView_MultiCharDelimiter_SplitsAllTokens)
+{
+    EXPECT_EQ(collect("a::b::c", "::"), (std::vector<std::string_view>{"a", "b", "c"}));
+}
+
+TEST(StringOperationsTest, SplitView_AdjacentAndTrailingDelimiters_KeepsEmptyTokens)
+{
+    EXPECT_EQ(collect(",a,,b,", ","), (std::vector<std::string_view>{"", "a", "", "b", ""}));
+}
+
+TEST(StringOperationsTest, SplitView_EmptyTextOrDelimiter_YieldsWholeText)
+{
+    EXPECT_EQ(collect("", ","), (std::vector<std::string_view>{""}));
+    EXPECT_EQ(collect("abc", ""), (std::vector<std::string_view>{"abc"}));
+}
+
+TEST(StringOperationsTest, SplitView_EarlyTermination_StopsAtFirstMatch)
+{
+    std::string_view found;
+    for (std::string_view token : stevensFileLib::splitView("x=1;y=2;z=3", ";"))
+    {
+        if (token.front() == 'y')
+        {
+            found = token;
+            break;
+        }
+    }
+
+    EXPECT_EQ(found, "y=2");
+}
+
+TEST(StringOperationsTest, SplitView_IteratorOutlivesTemporaryRange)
+{
+    const std::string text = "a,b,c";
+    auto it = stevensFileLib::splitView(text, ",").begin();
+
+    std::vector<std::string_view> tokens;
+    for (; it != stevensFileLib::SplitRange::iterator(); ++it)
+        tokens.push_back(*it);
+
+    EXPECT_EQ(tokens, (std::vector<std::string_view>{"a", "b", "c"}));
+}
+
+TEST(StringOperationsTest, SplitViewInto_ReusedVector_IsClearedAndRefilled)
+{
+    std::vector<std::string_view> tokens;
+
+    stevensFileLib::splitViewInto("1 2 3 4", " ", tokens);
+    ASSERT_EQ(tokens.size(), 4);
+
+    stevensFileLib::splitViewInto("5 6", " ", tokens);
+    EXPECT_EQ(tokens, (std::vector<std::string_view>{"5", "6"}));
+}
+
+TEST(StringOperationsTest, SplitString_MatchesSplitView)
+{
+    auto tokens = stevensFileLib::internal::splitString("a--b----c", "--");
+
+    EXPECT_EQ(tokens, (std::vector<std::string>{"a", "b", "", "c"}));
+}
@@ -0,0 +1,259 @@
+#include "stevensFileLib.hpp"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <atomic>
+#include <fstream>
+#include <string>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+class TracingTest : public ::testing::Test
+{
+protected:
+    const std::string testDir = "test_files_tracing";
+    const std::string testFile = testDir + "/test.txt";
+    std::shared_ptr<stevensFileLib::RingBufferTraceSink> sink;
+
+    void SetUp() override
+    {
+        fs::create_directories(testDir);
+        sink = std::make_shared<stevensFileLib::RingBufferTraceSink>(1024);
+    }
+
+    void TearDown() override
+    {
+        stevensFileLib::setTraceSink(nullptr);
+        if (fs::exists(testDir))
+            fs::remove_all(testDir);
+    }
+
+    void createTestFile(const std::string& path, const std::string& content)
+    {
+        std::ofstream file(path);
+        file << content;
+    }
+
+    static stevensFileLib::TraceEvent makeEvent(uint64_t bytes)
+    {
+        stevensFileLib::TraceEvent event;
+        event.kind = stevensFileLib::TraceEventKind::Read;
+        event.path = "synthetic";
+        event.bytes = bytes;
+        return event;
+    }
+};
+
+// ============================================================================
+// Tests for trace hooks
+// ============================================================================
+
+TEST_F(TracingTest, NoSinkInstalled_RecordsNothing)
+{
+    createTestFile(testFile, "one\ntwo\n");
+
+    stevensFileLib::loadFileIntoVector(testFile);
+
+    EXPECT_EQ(stevensFileLib::traceSink(), nullptr);
+    EXPECT_TRUE(sink->events().empty());
+}
+
+TEST_F(TracingTest, LoadFileIntoVector_ReportsOpenReadsAndClose)
+{
+    createTestFile(testFile, "one\ntwo\nthree\n");
+    stevensFileLib::setTraceSink(sink);
+
+    stevensFileLib::loadFileIntoVector(testFile);
+
+    auto events = sink->events();
+    ASSERT_GE(events.size(), 3);
+    EXPECT_EQ(events.front().kind, stevensFileLib::TraceEventKind::Open);
+    EXPECT_EQ(events.back().kind, stevensFileLib::TraceEventKind::Close);
+
+    uint64_t bytesRead = 0;
+    for (const auto& event : events)
+    {
+        EXPECT_EQ(event.path, testFile);
+        if (event.kind == stevensFileLib::TraceEventKind::Read)
+            bytesRead += event.bytes;
+    }
+    EXPECT_EQ(bytesRead, 14);
+}
+
+TEST_F(TracingTest, WriteLinesToFile_ReportsWriteBytes)
+{
+    stevensFileLib::setTraceSink(sink);
+
+    stevensFileLib::writeLinesToFile(testFile, {"alpha", "beta"});
+
+    auto events = sink->events();
+    ASSERT_EQ(events.size(), 3);
+    EXPECT_EQ(events[0].kind, stevensFileLib::TraceEventKind::Open);
+    EXPECT_EQ(events[1].kind, stevensFileLib::TraceEventKind::Write);
+    EXPECT_EQ(events[1].bytes, 11);
+    EXPECT_EQ(events[2].kind, stevensFileLib::TraceEventKind::Close);
+}
+
+TEST_F(TracingTest, WriteLinesToFile_FailedWrite_ReportsNoWriteEvent)
+{
+    if (!fs::exists("/dev/full"))
+        GTEST_SKIP() << "/dev/full is not available";
+    stevensFileLib::setTraceSink(sink);
+
+    EXPECT_THROW(stevensFileLib::writeLinesToFile("/dev/full", {"alpha", "beta"}), std::runtime_error);
+
+    for (const auto& event : sink->events())
+        EXPECT_NE(event.kind, stevensFileLib::TraceEventKind::Write);
+}
+
+#if STEVENS_FILE_LIB_POSIX
+TEST_F(TracingTest, WriteAll_FailedWrite_ReportsNoWriteEvent)
+{
+    stevensFileLib::internal::FileDescriptor full(::open("/dev/full", O_WRONLY | O_CLOEXEC));
+    if (!full)
+        GTEST_SKIP() << "/dev/full is not available";
+    stevensFileLib::setTraceSink(sink);
+
+    EXPECT_THROW(stevensFileLib::internal::writeAll(full.get(), "data", 4, "/dev/full"), std::runtime_error);
+
+    EXPECT_TRUE(sink->events().empty());
+}
+#endif
+
+TEST_F(TracingTest, OpenInputFile_ReportsOpen)
+{
+    createTestFile(testFile, "content");
+    stevensFileLib::setTraceSink(sink);
+
+    auto file = stevensFileLib::openInputFile(testFile);
+
+    auto events = sink->events();
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0].kind, stevensFileLib::TraceEventKind::Open);
+}
+
+// ============================================================================
+// Tests for RingBufferTraceSink
+// ============================================================================
+
+TEST_F(TracingTest, RingBuffer_Wraps_KeepsNewestEventsInOrder)
+{
+    stevensFileLib::RingBufferTraceSink small(4);
+    for (uint64_t i = 0; i < 10; ++i)
+        small.record(makeEvent(i));
+
+    auto events = small.events();
+    ASSERT_EQ(events.size(), 4);
+    for (uint64_t i = 0; i < 4; ++i)
+        EXPECT_EQ(events[i].bytes, 6 + i);
+}
+
+TEST_F(TracingTest, RingBuffer_LongPath_KeepsEnd)
+{
+    std::string longPath = std::string(200, 'd') + "/file.txt";
+    stevensFileLib::TraceEvent event = makeEvent(1);
+    event.path = longPath;
+
+    sink->record(event);
+
+    auto events = sink->events();
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0].path.size(), stevensFileLib::RingBufferTraceSink::maxPathLength);
+    EXPECT_EQ(events[0].path.substr(events[0].path.size() - 9), "/file.txt");
+}
+
+TEST_F(TracingTest, RingBuffer_EmptyPath_RecordsEvent)
+{
+    stevensFileLib::TraceEvent event = makeEvent(7);
+    event.path = std::string_view();
+
+    sink->record(event);
+
+    auto events = sink->events();
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_TRUE(events[0].path.empty());
+    EXPECT_EQ(events[0].bytes, 7);
+}
+
+TEST_F(TracingTest, RingBuffer_ConcurrentWriters_KeepsEveryEventWithinCapacity)
+{
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([this]
+        {
+            for (uint64_t i = 0; i < 200; ++i)
+                sink->record(makeEvent(i));
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(sink->events().size(), 800);
+}
+
+TEST_F(TracingTest, RingBuffer_WritersWrappingTheBuffer_NeverPublishMixedEvents)
+{
+    // Every field of an event carries the same value, so a torn slot shows up as a mismatch
+    stevensFileLib::RingBufferTraceSink tiny(2);
+    std::atomic<bool> done{false};
+    std::vector<std::thread> threads;
+    for (uint64_t t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&tiny, t]
+        {
+            for (uint64_t i = 0; i < 20000; ++i)
+            {
+                const uint64_t value = t * 1000000 + i;
+                const std::string path = std::to_string(value);
+                stevensFileLib::TraceEvent event = makeEvent(value);
+                event.path = path;
+                event.startNanoseconds = value;
+                event.durationNanoseconds = value;
+                tiny.record(event);
+            }
+        });
+    }
+
+    size_t torn = 0;
+    std::thread reader([&]
+    {
+        while (!done.load())
+        {
+            for (const auto& entry : tiny.events())
+            {
+                if (entry.startNanoseconds != entry.bytes || entry.durationNanoseconds != entry.bytes ||
+                    entry.path != std::to_string(entry.bytes))
+                    ++torn;
+            }
+        }
+    });
+
+    for (auto& thread : threads)
+        thread.join();
+    done = true;
+    reader.join();
+
+    EXPECT_EQ(torn, 0u);
+    EXPECT_FALSE(tiny.events().empty());
+}
+
+TEST_F(TracingTest, ToChromeTraceJson_FormatsCompleteEvents)
+{
+    stevensFileLib::TraceEvent event = makeEvent(42);
+    event.path = "dir/\"quoted\".txt";
+    event.startNanoseconds = 5000;
+    event.durationNanoseconds = 1500;
+    event.threadId = 3;
+    sink->record(event);
+
+    std::string json = sink->toChromeTraceJson();
+
+    EXPECT_NE(json.find("\"traceEvents\":["), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"read\""), std::string::npos);
+    EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(json.find("\"ts\":5.000,\"dur\":1.500"), std::string::npos);
+    EXPECT_NE(json.find("\"tid\":3"), std::string::npos);
+    EXPECT_NE(json.find("\"path\":\"dir/\\\"quoted\\\".txt\""), std::string::npos);
+    EXPECT_NE(json.find("\"bytes\":42"), std::string::npos);
+}